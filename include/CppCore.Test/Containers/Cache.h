@@ -0,0 +1,301 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+namespace CppCore { namespace Test { namespace Containers
+{
+   /// <summary>
+   /// Tests for Cache.h in CppCore::Containers
+   /// </summary>
+   class Cache
+   {
+   public:
+      /// <summary>
+      /// Compares cached integer with key
+      /// </summary>
+      class Comparer
+      {
+      public:
+         INLINE static bool equal(const CppCore::Cache::Entry<uint32_t>& a, const uint32_t& key) { return a.Data == key; }
+      };
+
+      template<CppCore::Cache::Policy POLICY>
+      using ST = CppCore::Cache::ST<uint32_t, uint32_t, 64, Comparer, 8, POLICY>;
+
+      /// <summary>
+      /// Inserts keys [0, n) and releases their references.
+      /// </summary>
+      template<typename TCACHE>
+      INLINE static bool fill(TCACHE& cache, uint32_t n)
+      {
+         for (uint32_t i = 0; i < n; i++)
+         {
+            auto* e = cache.popFreeEntry();
+            if (!e) return false;
+            e->Data.Data = i;
+            if (!cache.insert(i, e, 10)) return false;
+            e->Data.Refs = 0;
+         }
+         return cache.length() == n;
+      }
+
+      /// <summary>
+      /// Looks up key and releases the reference again.
+      /// </summary>
+      template<typename TCACHE>
+      INLINE static bool touch(TCACHE& cache, uint32_t key)
+      {
+         auto* e = cache.find(key);
+         if (!e || e->Data != key || e->Refs != 1) return false;
+         e->Refs = 0;
+         return true;
+      }
+
+      /// <summary>
+      /// Checks the prune list against expected keys and removes them.
+      /// </summary>
+      template<typename TCACHE>
+      INLINE static bool prunecheck(TCACHE& cache, const uint32_t* keys, size_t n)
+      {
+         if (!cache.prune(seconds(0), n)) return false;
+         if (cache.getPruneList().length() != n) return false;
+         for (size_t i = 0; i < n; i++)
+            if (cache.getPruneList()[i]->Data != keys[i])
+               return false;
+         for (size_t i = 0; i < n; i++)
+            if (!cache.remove(keys[i]))
+               return false;
+         return true;
+      }
+
+      INLINE static bool lru()
+      {
+         ST<CppCore::Cache::Policy::LRU> cache;
+         const uint32_t k1[] = { 0, 2, 4, 5 };
+         const uint32_t k2[] = { 6, 7, 9, 3 };
+         const uint32_t k3[] = { 1, 8 };
+
+         if (!fill(cache, 10))       return false;
+         if (!touch(cache, 3))       return false;
+         if (!touch(cache, 1))       return false;
+         if (!touch(cache, 8))       return false;
+         if (cache.prune())          return false; // all too young
+         if (!prunecheck(cache, k1, 4)) return false;
+
+         // referenced one is skipped and can't be removed
+         if (!cache.find(8))         return false;
+         if (!prunecheck(cache, k2, 4)) return false;
+         if (cache.remove(8))        return false;
+         cache.find(8)->Refs = 0;
+         if (!prunecheck(cache, k3, 2)) return false;
+         if (cache.length() != 0)    return false;
+         if (cache.getMemoryUsage() != 0) return false;
+         if (cache.prune(seconds(0))) return false;
+
+         // urgent when over memory limit, ignores age
+         if (!fill(cache, 4))        return false;
+         cache.setMemoryLimit(30);
+         if (!cache.prune())         return false;
+         if (cache.getPruneList().length() != 4) return false;
+         return true;
+      }
+
+      INLINE static bool clock()
+      {
+         ST<CppCore::Cache::Policy::CLOCK> cache;
+         const uint32_t k1[] = { 0, 2, 4, 5 };
+         const uint32_t k2[] = { 6, 7, 9, 1 };
+         const uint32_t k3[] = { 8, 3 };
+
+         if (!fill(cache, 10))       return false;
+         if (cache.prune())          return false; // all too young
+         if (!touch(cache, 3))       return false;
+         if (!touch(cache, 1))       return false;
+         if (!prunecheck(cache, k1, 4)) return false;
+
+         // second chance for used one, referenced one is skipped
+         if (!touch(cache, 8))       return false;
+         if (!cache.find(3))         return false;
+         if (!prunecheck(cache, k2, 4)) return false;
+         cache.find(3)->Refs = 0;
+         if (!prunecheck(cache, k3, 2)) return false;
+         if (cache.length() != 0)    return false;
+         if (cache.getMemoryUsage() != 0) return false;
+         if (cache.prune(seconds(0))) return false;
+         return true;
+      }
+
+      /// <summary>
+      /// Prunes with maxnum above the number of candidates, the second
+      /// round of CLOCK must not list an entry twice.
+      /// </summary>
+      template<CppCore::Cache::Policy POLICY>
+      INLINE static bool fewer(const uint32_t* keys)
+      {
+         ST<POLICY> cache;
+         if (!fill(cache, 3))        return false;
+         if (!touch(cache, 1))       return false;
+         if (!prunecheck(cache, keys, 3)) return false;
+         if (cache.length() != 0)    return false;
+
+         // all candidates in first round
+         if (!fill(cache, 3))        return false;
+         const uint32_t k[] = { 0, 1, 2 };
+         return prunecheck(cache, k, 3) && cache.length() == 0;
+      }
+
+      INLINE static bool lrufewer()
+      {
+         const uint32_t k[] = { 0, 2, 1 };
+         return fewer<CppCore::Cache::Policy::LRU>(k);
+      }
+
+      INLINE static bool clockfewer()
+      {
+         const uint32_t k[] = { 0, 2, 1 };
+         return fewer<CppCore::Cache::Policy::CLOCK>(k);
+      }
+
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// A hit after the last prune stores the tick of that prune. It must
+      /// not look as old as the time since then to the next prune.
+      /// </summary>
+      template<CppCore::Cache::Policy POLICY>
+      INLINE static bool recent()
+      {
+         ST<POLICY> cache;
+         if (!fill(cache, 1))        return false;
+         if (cache.prune(hours(1)))  return false;
+         ::std::this_thread::sleep_for(milliseconds(50));
+         if (!touch(cache, 0))       return false;
+         if (cache.prune(milliseconds(20))) return false;
+
+         // ages from the tick before the hit once refreshed again
+         ::std::this_thread::sleep_for(milliseconds(50));
+         if (!cache.prune(milliseconds(20))) return false;
+         return cache.getPruneList().length() == 1 && cache.getPruneList()[0]->Data == 0;
+      }
+
+      INLINE static bool lrurecent()   { return recent<CppCore::Cache::Policy::LRU>(); }
+      INLINE static bool clockrecent() { return recent<CppCore::Cache::Policy::CLOCK>(); }
+
+      using MT = CppCore::Cache::MT<uint32_t, uint32_t, 1024, Comparer, 16, 8>;
+
+      /// <summary>
+      /// Returns the key of cached data
+      /// </summary>
+      INLINE static uint32_t keyof(const uint32_t& data) { return data; }
+
+      INLINE static bool mt()
+      {
+         auto cache = ::std::make_unique<MT>();
+         MT::Stats stats;
+         uint32_t item;
+
+         // insert keys spread over all shards
+         for (uint32_t i = 0; i < 512; i++)
+         {
+            auto* e = cache->popFreeEntry(i);
+            if (!e) return false;
+            e->Data.Data = i;
+            if (!cache->insert(i, e, 1)) return false;
+            cache->release(i, &e->Data);
+         }
+         if (cache->length() != 512) return false;
+         if (cache->getMemoryUsage() != 512) return false;
+
+         // hits and misses
+         for (uint32_t i = 0; i < 1024; i++)
+            if (cache->find(i, item) != (i < 512) || (i < 512 && item != i))
+               return false;
+         auto* e = cache->find(7);
+         if (!e || e->Data != 7) return false;
+         cache->getStats(stats);
+         if (stats.Hits != 513 || stats.Misses != 512 || stats.Evictions != 0) return false;
+
+         // evict all except referenced one
+         if (cache->evict(keyof, seconds(60)) != 0) return false;
+         size_t n = 0;
+         while (size_t k = cache->evict(keyof, seconds(0), 16))
+            n += k;
+         if (n != 511 || cache->length() != 1) return false;
+         cache->release(7, e);
+         if (cache->evict(keyof, seconds(0)) != 1 || cache->length() != 0) return false;
+         cache->getStats(stats);
+         if (stats.Evictions != 512) return false;
+         return true;
+      }
+
+      INLINE static bool mtthreaded()
+      {
+         constexpr uint32_t THREADS = 4;
+         constexpr uint32_t ITEMS = 20000;
+         constexpr uint32_t KEYS = 1200;
+         auto cache = ::std::make_unique<MT>();
+         atomic<size_t> errors(0);
+         ::std::thread threads[THREADS];
+
+         // all threads look up all keys, but each one only inserts its own ones
+         for (uint32_t t = 0; t < THREADS; t++)
+            threads[t] = ::std::thread([&cache, &errors, t]() {
+               MT& c = *cache;
+               for (uint32_t i = 0; i < ITEMS; i++)
+               {
+                  const uint32_t key = (i * 7919U + t * 13U) % KEYS;
+                  if (CppCore::Cache::Entry<uint32_t>* e = c.find(key))
+                  {
+                     if (e->Data != key) errors++;
+                     c.release(key, e);
+                  }
+                  else if (key % THREADS == t)
+                  {
+                     auto* f = c.popFreeEntry(key);
+                     if (!f)
+                        c.evict(keyof, seconds(0), 4);
+                     else
+                     {
+                        f->Data.Data = key;
+                        if (!c.insert(key, f, 1)) errors++;
+                        c.release(key, &f->Data);
+                     }
+                  }
+               }
+            });
+
+         for (uint32_t t = 0; t < THREADS; t++) 
+            threads[t].join();
+
+         MT::Stats stats;
+         cache->getStats(stats);
+         return 
+            errors.load() == 0 && 
+            stats.Hits + stats.Misses == THREADS * ITEMS &&
+            stats.Evictions > 0;
+      }
+   #endif
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Containers
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(Cache)
+   {
+   public:
+      TEST_METHOD(LRU)   { Assert::AreEqual(true, CppCore::Test::Containers::Cache::lru()); }
+      TEST_METHOD(CLOCK) { Assert::AreEqual(true, CppCore::Test::Containers::Cache::clock()); }
+      TEST_METHOD(LRUFEWER)   { Assert::AreEqual(true, CppCore::Test::Containers::Cache::lrufewer()); }
+      TEST_METHOD(CLOCKFEWER) { Assert::AreEqual(true, CppCore::Test::Containers::Cache::clockfewer()); }
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(LRURECENT)   { Assert::AreEqual(true, CppCore::Test::Containers::Cache::lrurecent()); }
+      TEST_METHOD(CLOCKRECENT) { Assert::AreEqual(true, CppCore::Test::Containers::Cache::clockrecent()); }
+      TEST_METHOD(MT)         { Assert::AreEqual(true, CppCore::Test::Containers::Cache::mt()); }
+      TEST_METHOD(MTTHREADED) { Assert::AreEqual(true, CppCore::Test::Containers::Cache::mtthreaded()); }
+   #endif
+   };
+}}}}
+#endif
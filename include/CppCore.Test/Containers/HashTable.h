@@ -74,6 +74,170 @@ namespace CppCore { namespace Test { namespace Containers
 
          return true;
       }
+
+      /// <summary>
+      /// Hasher mapping keys to few home slots with identical tags.
+      /// Creates long clusters that wrap around the table end.
+      /// </summary>
+      class BadHasher
+      {
+      public:
+         using Digest = uint32_t;
+         INLINE void hash(uint32_t key, Digest& digest) { digest = (key & 3U) * 5U + 3U; }
+      };
+
+      /// <summary>
+      /// Random inserts and removes checked against a plain array
+      /// </summary>
+      template<size_t CAPACITY, size_t TABLESIZE, typename HASHER>
+      INLINE static bool flatrandom()
+      {
+         using HT = CppCore::HashTable::Flat<uint32_t, uint32_t, CAPACITY, 
+            Comparer<uint32_t, uint32_t>, TABLESIZE, HASHER>;
+
+         constexpr uint32_t KEYS = (uint32_t)CAPACITY * 2U;
+         HT*  ht = new HT();
+         bool has[KEYS] = { };
+         size_t n = 0;
+         uint32_t v;
+
+         Random::Xorshift32 rnd(1234U);
+         for (size_t i = 0; i < 20000; i++)
+         {
+            const uint32_t key = rnd.next() % KEYS;
+            if (has[key])
+            {
+               if (!ht->remove(key, v) || v != key) 
+                  { delete ht; return false; }
+               has[key] = false;
+               n--;
+            }
+            else if (n < CAPACITY)
+            {
+               if (!ht->insert(key, key)) 
+                  { delete ht; return false; }
+               has[key] = true;
+               n++;
+            }
+            else if (ht->insert(key, key))
+               { delete ht; return false; }
+
+            // check all keys
+            if (ht->length() != n)
+               { delete ht; return false; }
+            for (uint32_t k = 0; k < KEYS; k++)
+            {
+               const uint32_t* p = ht->find(k);
+               if (has[k] ? (!p || *p != k) : (p != nullptr))
+                  { delete ht; return false; }
+            }
+         }
+
+         // iterate remaining
+         size_t cnt = 0;
+         for (uint32_t x : *ht)
+         {
+            if (x >= KEYS || !has[x])
+               { delete ht; return false; }
+            cnt++;
+         }
+         if (cnt != n)
+            { delete ht; return false; }
+
+         // clear
+         ht->clear();
+         if (ht->length() != 0 || ht->find(0) || !ht->insert(0, 0) || !ht->find(0))
+            { delete ht; return false; }
+
+         delete ht;
+         return true;
+      }
+      INLINE static bool flat()
+      {
+         // full table, smaller than one group
+         if (!flatrandom<8, 8, Murmur3>())     return false;
+         if (!flatrandom<16, 16, BadHasher>()) return false;
+
+         // multiple groups, full and half used
+         if (!flatrandom<64, 64, BadHasher>())  return false;
+         if (!flatrandom<100, 128, Murmur3>())  return false;
+         if (!flatrandom<500, 1024, Murmur3>()) return false;
+         return true;
+      }
+
+   #ifndef CPPCORE_NO_THREADING
+      using MT = CppCore::HashTable::MT<uint32_t, uint32_t, 1024, Comparer<uint32_t, uint32_t>>;
+
+      INLINE static bool mt()
+      {
+         auto ht = ::std::make_unique<MT>();
+         uint32_t v;
+
+         // fill, exceeding pool must fail
+         for (uint32_t i = 0; i < 1024; i++)
+            if (!ht->insert(i, i))
+               return false;
+         if (ht->insert(1024, 1024) || ht->length() != 1024)
+            return false;
+
+         // find all
+         for (uint32_t i = 0; i < 1024; i++)
+            if (!ht->find(i, v) || v != i)
+               return false;
+         if (ht->find(1024, v))
+            return false;
+
+         // remove half
+         for (uint32_t i = 0; i < 1024; i += 2)
+            if (!ht->remove(i, v) || v != i)
+               return false;
+         for (uint32_t i = 1; i < 1024; i += 2)
+            if (!ht->removeAndPushFree(i))
+               return false;
+         if (ht->remove(0, v) || ht->length() != 0)
+            return false;
+
+         // entries were returned to pool
+         for (uint32_t i = 0; i < 1024; i++)
+            if (!ht->insert(i + 5000, i))
+               return false;
+         ht->clear();
+         return ht->length() == 0 && !ht->find(5000, v) && ht->insert(1, 1);
+      }
+      INLINE static bool mtthreaded()
+      {
+         constexpr uint32_t THREADS = 4;
+         constexpr uint32_t KEYS = 200;
+         constexpr uint32_t ROUNDS = 200;
+         auto ht = ::std::make_unique<MT>();
+         atomic<size_t> errors(0);
+         ::std::thread threads[THREADS];
+
+         // each thread inserts and removes its own keys 
+         // and looks up the ones of the others meanwhile
+         for (uint32_t t = 0; t < THREADS; t++)
+            threads[t] = ::std::thread([&ht, &errors, t]() {
+               MT& h = *ht;
+               uint32_t v;
+               for (uint32_t r = 0; r < ROUNDS; r++)
+               {
+                  for (uint32_t i = 0; i < KEYS; i++)
+                     if (!h.insert(t * KEYS + i, t * KEYS + i)) errors++;
+                  for (uint32_t i = 0; i < KEYS * THREADS; i++)
+                     if (h.find(i, v) && v != i) errors++;
+                  for (uint32_t i = 0; i < KEYS; i++)
+                     if (!h.find(t * KEYS + i, v) || v != t * KEYS + i) errors++;
+                  for (uint32_t i = 0; i < KEYS; i++)
+                     if (!h.remove(t * KEYS + i, v) || v != t * KEYS + i) errors++;
+               }
+            });
+
+         for (uint32_t t = 0; t < THREADS; t++) 
+            threads[t].join();
+
+         return errors.load() == 0 && ht->length() == 0;
+      }
+   #endif
    };
 }}}
 
@@ -88,6 +252,11 @@ namespace CppCore { namespace Test { namespace VS { namespace Containers
    public:
       TEST_METHOD(MODELID)   { Assert::AreEqual(true, CppCore::Test::Containers::HashTable::modelid()); }
       TEST_METHOD(MODELNAME) { Assert::AreEqual(true, CppCore::Test::Containers::HashTable::modelname()); }
+      TEST_METHOD(FLAT)          { Assert::AreEqual(true, CppCore::Test::Containers::HashTable::flat()); }
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(MT)            { Assert::AreEqual(true, CppCore::Test::Containers::HashTable::mt()); }
+      TEST_METHOD(MTTHREADED)    { Assert::AreEqual(true, CppCore::Test::Containers::HashTable::mtthreaded()); }
+   #endif
    };
 }}}}
 #endif
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+namespace CppCore { namespace Test { namespace Containers
+{
+   /// <summary>
+   /// Tests for Pool.h in CppCore::Containers
+   /// </summary>
+   class Pool
+   {
+   public:
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// Pops all items, checks they are distinct and from the pool.
+      /// </summary>
+      template<typename TPOOL, size_t SIZE>
+      INLINE static bool drain(TPOOL& pool, uint32_t** items)
+      {
+         ::std::unique_ptr<bool[]> seen(new bool[SIZE]());
+         for (size_t i = 0; i < SIZE; i++)
+         {
+            if (!pool.popBack(items[i]))
+               return false;
+            const size_t idx = (size_t)(items[i] - pool.getPoolPtr());
+            if (idx >= SIZE || seen[idx])
+               return false;
+            seen[idx] = true;
+         }
+         uint32_t* t;
+         return !pool.popBack(t);
+      }
+      template<size_t SIZE, size_t MAGSIZE = 0U>
+      INLINE static bool mt()
+      {
+         using MT = CppCore::Pool::Fix::MT<uint32_t, SIZE, 16U, MAGSIZE>;
+         auto pool = ::std::make_unique<MT>();
+         uint32_t* items[SIZE];
+         uint32_t foreign;
+
+         // exhaust, push back all, exhaust again
+         if (!drain<MT, SIZE>(*pool, items))
+            return false;
+         if (pool->pushBack(&foreign))
+            return false;
+         for (size_t i = 0; i < SIZE; i++)
+            if (!pool->pushBack(items[i]))
+               return false;
+         if (!drain<MT, SIZE>(*pool, items))
+            return false;
+
+         // push back in other order
+         for (size_t i = 0; i < SIZE; i++)
+            if (!pool->pushBack(items[(i * 37U) % SIZE]))
+               return false;
+         return drain<MT, SIZE>(*pool, items);
+      }
+      INLINE static bool mtcached()
+      {
+         return mt<1000, 15>();
+      }
+      INLINE static bool mtthreaded()
+      {
+         constexpr uint32_t THREADS = 8;
+         constexpr uint32_t ROUNDS = 20000;
+         constexpr uint32_t HOLD = 20;
+
+         // less magazines than threads to have them shared
+         using MT = CppCore::Pool::Fix::MT<uint32_t, 128, 4, 8>;
+         auto pool = ::std::make_unique<MT>();
+         atomic<size_t> errors(0);
+         ::std::thread threads[THREADS];
+
+         // each thread holds up to HOLD items at once and marks them, 
+         // an item handed out twice gets overwritten by the other thread
+         for (uint32_t t = 0; t < THREADS; t++)
+            threads[t] = ::std::thread([&pool, &errors, t]() {
+               MT& p = *pool;
+               uint32_t* held[HOLD];
+               for (uint32_t r = 0; r < ROUNDS; r++)
+               {
+                  const uint32_t n = 1U + (r * 7U + t) % HOLD;
+                  uint32_t got = 0;
+                  for (; got < n; got++)
+                  {
+                     if (!p.popBack(held[got])) break;
+                     *held[got] = t * ROUNDS + r;
+                  }
+                  for (uint32_t i = 0; i < got; i++)
+                  {
+                     if (*held[i] != t * ROUNDS + r) errors++;
+                     if (!p.pushBack(held[i])) errors++;
+                  }
+               }
+            });
+
+         for (uint32_t t = 0; t < THREADS; t++)
+            threads[t].join();
+
+         // nothing lost or duplicated
+         uint32_t* items[128];
+         return errors.load() == 0 && drain<MT, 128>(*pool, items);
+      }
+
+      /// <summary>
+      /// Without magazines all items can be popped by one thread,
+      /// while another one that used the pool is still alive.
+      /// </summary>
+      template<typename MT>
+      INLINE static bool capacity()
+      {
+         constexpr size_t SIZE = 256;
+         auto pool = ::std::make_unique<MT>();
+         atomic<bool> used(false), stop(false);
+
+         // pops and pushes back some items, then stays alive
+         ::std::thread other([&pool, &used, &stop]() {
+            uint32_t* held[32];
+            for (size_t i = 0; i < 32; i++)
+               pool->popBack(held[i]);
+            for (size_t i = 0; i < 32; i++)
+               pool->pushBack(held[i]);
+            used = true;
+            while (!stop.load())
+               ::std::this_thread::yield();
+         });
+
+         while (!used.load())
+            ::std::this_thread::yield();
+         uint32_t* items[SIZE];
+         const bool ok = drain<MT, SIZE>(*pool, items);
+         stop = true;
+         other.join();
+         return ok;
+      }
+      INLINE static bool capacityexact()
+      {
+         return capacity<CppCore::Pool::Fix::MT<uint32_t, 256>>();
+      }
+      INLINE static bool capacitycached()
+      {
+         // magazines hide items of the other thread
+         return !capacity<CppCore::Pool::Fix::MTCached<uint32_t, 256, 4>>();
+      }
+   #endif
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Containers
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(Pool)
+   {
+   public:
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(MT)         { Assert::AreEqual(true, CppCore::Test::Containers::Pool::mt<100>()); }
+      TEST_METHOD(MTCACHED)   { Assert::AreEqual(true, CppCore::Test::Containers::Pool::mtcached()); }
+      TEST_METHOD(MTTHREADED) { Assert::AreEqual(true, CppCore::Test::Containers::Pool::mtthreaded()); }
+      TEST_METHOD(CAPACITYEXACT)  { Assert::AreEqual(true, CppCore::Test::Containers::Pool::capacityexact()); }
+      TEST_METHOD(CAPACITYCACHED) { Assert::AreEqual(true, CppCore::Test::Containers::Pool::capacitycached()); }
+   #endif
+   };
+}}}}
+#endif
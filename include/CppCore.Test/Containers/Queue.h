@@ -59,6 +59,82 @@ namespace CppCore { namespace Test { namespace Containers
       INLINE static bool fillmaxthenempty2() { return fillmaxthenempty<uint64_t, 10>(); }
       INLINE static bool fillmaxthenempty3() { return fillmaxthenempty<Model,    12>(); }
       INLINE static bool fillmaxthenempty4() { return fillmaxthenempty<Model,   256>(); }
+
+   #ifndef CPPCORE_NO_THREADING
+      template<typename QUEUE>
+      INLINE static bool lockfreefifo()
+      {
+         QUEUE container;
+         size_t item;
+
+         // twice to wrap the indices around
+         for (size_t k = 0; k < 2; k++)
+         {
+            for (size_t i = 0; i < container.size(); i++)
+            {
+               if (i != container.length()) return false;
+               if (!container.pushBack(i)) return false;
+            }
+
+            if (container.pushBack(0)) return false;
+
+            for (size_t i = 0; i < container.size(); i++)
+            {
+               if (!container.popFront(item)) return false;
+               if (item != i) return false;
+            }
+
+            if (container.popFront(item)) return false;
+            if (container.length() != 0) return false;
+         }
+
+         return true;
+      }
+      INLINE static bool lockfreefifo1() { return lockfreefifo<CppCore::Queue::MPMC<size_t,   2>>(); }
+      INLINE static bool lockfreefifo2() { return lockfreefifo<CppCore::Queue::MPMC<size_t, 256>>(); }
+      INLINE static bool lockfreefifo3() { return lockfreefifo<CppCore::Queue::SPSC<size_t,   1>>(); }
+      INLINE static bool lockfreefifo4() { return lockfreefifo<CppCore::Queue::SPSC<size_t, 256>>(); }
+
+      template<typename QUEUE, size_t PRODUCERS, size_t CONSUMERS>
+      INLINE static bool lockfreethreaded()
+      {
+         constexpr size_t ITEMS = 10000;
+         QUEUE container;
+         atomic<size_t> sum(0);
+         atomic<size_t> count(0);
+         ::std::thread producers[PRODUCERS];
+         ::std::thread consumers[CONSUMERS];
+
+         for (size_t p = 0; p < PRODUCERS; p++)
+            producers[p] = ::std::thread([&container]() {
+               for (size_t i = 1; i <= ITEMS; i++)
+                  while (!container.pushBack(i))
+                     ::std::this_thread::yield();
+            });
+
+         for (size_t c = 0; c < CONSUMERS; c++)
+            consumers[c] = ::std::thread([&container, &sum, &count]() {
+               size_t item;
+               while (count.load() < ITEMS * PRODUCERS)
+               {
+                  if (container.popFront(item))
+                  {
+                     sum += item;
+                     count++;
+                  }
+                  else
+                     ::std::this_thread::yield();
+               }
+            });
+
+         for (size_t p = 0; p < PRODUCERS; p++) producers[p].join();
+         for (size_t c = 0; c < CONSUMERS; c++) consumers[c].join();
+
+         return sum.load() == PRODUCERS * (ITEMS * (ITEMS + 1) / 2);
+      }
+      INLINE static bool lockfreethreaded1() { return lockfreethreaded<CppCore::Queue::MPMC<size_t, 64>, 4, 4>(); }
+      INLINE static bool lockfreethreaded2() { return lockfreethreaded<CppCore::Queue::SPSC<size_t, 64>, 1, 1>(); }
+   #endif
    };
 }}}
 
@@ -75,6 +151,14 @@ namespace CppCore { namespace Test { namespace VS { namespace Containers
       TEST_METHOD(FILLMAXTHENEMPTY2) { Assert::AreEqual(true, CppCore::Test::Containers::Queue::fillmaxthenempty2()); }
       TEST_METHOD(FILLMAXTHENEMPTY3) { Assert::AreEqual(true, CppCore::Test::Containers::Queue::fillmaxthenempty3()); }
       TEST_METHOD(FILLMAXTHENEMPTY4) { Assert::AreEqual(true, CppCore::Test::Containers::Queue::fillmaxthenempty4()); }
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(LOCKFREEFIFO1)     { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreefifo1()); }
+      TEST_METHOD(LOCKFREEFIFO2)     { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreefifo2()); }
+      TEST_METHOD(LOCKFREEFIFO3)     { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreefifo3()); }
+      TEST_METHOD(LOCKFREEFIFO4)     { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreefifo4()); }
+      TEST_METHOD(LOCKFREETHREADED1) { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreethreaded1()); }
+      TEST_METHOD(LOCKFREETHREADED2) { Assert::AreEqual(true, CppCore::Test::Containers::Queue::lockfreethreaded2()); }
+   #endif
    };
 }}}}
 #endif
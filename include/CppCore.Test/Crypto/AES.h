@@ -524,6 +524,252 @@ namespace CppCore { namespace Test { namespace Crypto
 
          return true;
       }
+
+      /// <summary>
+      /// Compares two implementations on buffers of 0 to 40 blocks (plus tail for CTR)
+      /// to cover the multi block and single block paths.
+      /// </summary>
+      template<typename TAES1, typename TAES2>
+      INLINE static bool bulk(const void* key)
+      {
+         constexpr size_t MAXBLOCKS = 40U;
+         CPPCORE_ALIGN16 uint8_t in  [MAXBLOCKS*16U+15U];
+         CPPCORE_ALIGN16 uint8_t out1[MAXBLOCKS*16U+15U];
+         CPPCORE_ALIGN16 uint8_t out2[MAXBLOCKS*16U+15U];
+         CPPCORE_ALIGN16 uint8_t iv1[16];
+         CPPCORE_ALIGN16 uint8_t iv2[16];
+
+         for (size_t i = 0; i < sizeof(in); i++)
+            in[i] = (uint8_t)(i * 7U + 3U);
+
+         TAES1 aes1(key);
+         TAES2 aes2(key);
+
+         for (size_t n = 0; n <= MAXBLOCKS; n++)
+         {
+            // ecb
+            aes1.encryptECB(in, out1, n);
+            aes2.encryptECB(in, out2, n);
+            if (::memcmp(out1, out2, n*16U) != 0) return false;
+            aes1.decryptECB(in, out1, n);
+            aes2.decryptECB(in, out2, n);
+            if (::memcmp(out1, out2, n*16U) != 0) return false;
+
+            // cbc
+            ::memcpy(iv1, ivec, 16); ::memcpy(iv2, ivec, 16);
+            aes1.encryptCBC(in, out1, iv1, n);
+            aes2.encryptCBC(in, out2, iv2, n);
+            if (::memcmp(out1, out2, n*16U) != 0 || ::memcmp(iv1, iv2, 16) != 0) return false;
+            ::memcpy(iv1, ivec, 16); ::memcpy(iv2, ivec, 16);
+            aes1.decryptCBC(in, out1, iv1, n);
+            aes2.decryptCBC(in, out2, iv2, n);
+            if (::memcmp(out1, out2, n*16U) != 0 || ::memcmp(iv1, iv2, 16) != 0) return false;
+
+            // ctr with tail
+            const size_t LEN = n*16U + (n % 16U);
+            ::memcpy(iv1, ivec, 16); ::memcpy(iv2, ivec, 16);
+            aes1.encryptCTR(in, out1, iv1, LEN);
+            aes2.encryptCTR(in, out2, iv2, LEN);
+            if (::memcmp(out1, out2, LEN) != 0 || ::memcmp(iv1, iv2, 16) != 0) return false;
+         }
+         return true;
+      }
+   #if defined(CPPCORE_CPUFEAT_AES) && defined(CPPCORE_CPUFEAT_SSE41)
+      INLINE static bool bulk128s() { return bulk<CppCore::AES128s, CppCore::AES128g>(key128); }
+      INLINE static bool bulk192s() { return bulk<CppCore::AES192s, CppCore::AES192g>(key192); }
+      INLINE static bool bulk256s() { return bulk<CppCore::AES256s, CppCore::AES256g>(key256); }
+   #endif
+
+      //////////////////////////////////////////////////
+      // GCM (Galois/Counter Mode)
+      //////////////////////////////////////////////////
+
+      static constexpr const uint8_t gcmkey[32] =
+      {
+         0xfe,0xff,0xe9,0x92,0x86,0x65,0x73,0x1c,
+         0x6d,0x6a,0x8f,0x94,0x67,0x30,0x83,0x08,
+         0xfe,0xff,0xe9,0x92,0x86,0x65,0x73,0x1c,
+         0x6d,0x6a,0x8f,0x94,0x67,0x30,0x83,0x08
+      };
+      static constexpr const uint8_t gcmiv[12] =
+      {
+         0xca,0xfe,0xba,0xbe,0xfa,0xce,0xdb,0xad,
+         0xde,0xca,0xf8,0x88
+      };
+      static constexpr const uint8_t gcmaad[20] =
+      {
+         0xfe,0xed,0xfa,0xce,0xde,0xad,0xbe,0xef,
+         0xfe,0xed,0xfa,0xce,0xde,0xad,0xbe,0xef,
+         0xab,0xad,0xda,0xd2
+      };
+      static constexpr const uint8_t gcmplain[64] =
+      {
+         0xd9,0x31,0x32,0x25,0xf8,0x84,0x06,0xe5,
+         0xa5,0x59,0x09,0xc5,0xaf,0xf5,0x26,0x9a,
+         0x86,0xa7,0xa9,0x53,0x15,0x34,0xf7,0xda,
+         0x2e,0x4c,0x30,0x3d,0x8a,0x31,0x8a,0x72,
+         0x1c,0x3c,0x0c,0x95,0x95,0x68,0x09,0x53,
+         0x2f,0xcf,0x0e,0x24,0x49,0xa6,0xb5,0x25,
+         0xb1,0x6a,0xed,0xf5,0xaa,0x0d,0xe6,0x57,
+         0xba,0x63,0x7b,0x39,0x1a,0xaf,0xd2,0x55
+      };
+
+      /// <summary>
+      /// Encrypts and decrypts len Bytes and compares with expected cipher and tag.
+      /// Also verifies that a modified tag is rejected.
+      /// </summary>
+      template<typename TGCM>
+      INLINE static bool gcm(
+         TGCM& gcm, const void* iv, const void* aad, const size_t aadlen,
+         const void* plain, const void* cipher, const size_t len, const void* tag)
+      {
+         uint8_t out_cipher[64];
+         uint8_t out_plain[64];
+         uint8_t out_tag[16];
+
+         gcm.encrypt(iv, aad, aadlen, plain, out_cipher, len, out_tag);
+         if (::memcmp(cipher, out_cipher, len) != 0 || ::memcmp(tag, out_tag, 16) != 0)
+            return false;
+         if (!gcm.decrypt(iv, aad, aadlen, cipher, out_plain, len, tag))
+            return false;
+         if (::memcmp(plain, out_plain, len) != 0)
+            return false;
+         out_tag[15] ^= 0x01;
+         if (gcm.decrypt(iv, aad, aadlen, cipher, out_plain, len, out_tag))
+            return false;
+         return true;
+      }
+
+      template<typename TGCM>
+      INLINE static bool gcm128()
+      {
+         // NIST GCM Test Case 2
+         const uint8_t key2[16]    = { 0 };
+         const uint8_t iv2[12]     = { 0 };
+         const uint8_t plain2[16]  = { 0 };
+         const uint8_t cipher2[16] = {
+            0x03,0x88,0xda,0xce,0x60,0xb6,0xa3,0x92,
+            0xf3,0x28,0xc2,0xb9,0x71,0xb2,0xfe,0x78
+         };
+         const uint8_t tag2[16] = {
+            0xab,0x6e,0x47,0xd4,0x2c,0xec,0x13,0xbd,
+            0xf5,0x3a,0x67,0xb2,0x12,0x57,0xbd,0xdf
+         };
+         // NIST GCM Test Case 3 and 4
+         const uint8_t cipher3[64] = {
+            0x42,0x83,0x1e,0xc2,0x21,0x77,0x74,0x24,
+            0x4b,0x72,0x21,0xb7,0x84,0xd0,0xd4,0x9c,
+            0xe3,0xaa,0x21,0x2f,0x2c,0x02,0xa4,0xe0,
+            0x35,0xc1,0x7e,0x23,0x29,0xac,0xa1,0x2e,
+            0x21,0xd5,0x14,0xb2,0x54,0x66,0x93,0x1c,
+            0x7d,0x8f,0x6a,0x5a,0xac,0x84,0xaa,0x05,
+            0x1b,0xa3,0x0b,0x39,0x6a,0x0a,0xac,0x97,
+            0x3d,0x58,0xe0,0x91,0x47,0x3f,0x59,0x85
+         };
+         const uint8_t tag3[16] = {
+            0x4d,0x5c,0x2a,0xf3,0x27,0xcd,0x64,0xa6,
+            0x2c,0xf3,0x5a,0xbd,0x2b,0xa6,0xfa,0xb4
+         };
+         const uint8_t tag4[16] = {
+            0x5b,0xc9,0x4f,0xbc,0x32,0x21,0xa5,0xdb,
+            0x94,0xfa,0xe9,0x5a,0xe7,0x12,0x1a,0x47
+         };
+
+         TGCM gcm;
+         gcm.reset(key2);
+         if (!AES::gcm(gcm, iv2, 0, 0, plain2, cipher2, 16, tag2))
+            return false;
+         gcm.reset(gcmkey);
+         if (!AES::gcm(gcm, gcmiv, 0, 0, gcmplain, cipher3, 64, tag3))
+            return false;
+         if (!AES::gcm(gcm, gcmiv, gcmaad, 20, gcmplain, cipher3, 60, tag4))
+            return false;
+         return true;
+      }
+
+      template<typename TGCM>
+      INLINE static bool gcm192()
+      {
+         // NIST GCM Test Case 10
+         const uint8_t cipher[60] = {
+            0x39,0x80,0xca,0x0b,0x3c,0x00,0xe8,0x41,
+            0xeb,0x06,0xfa,0xc4,0x87,0x2a,0x27,0x57,
+            0x85,0x9e,0x1c,0xea,0xa6,0xef,0xd9,0x84,
+            0x62,0x85,0x93,0xb4,0x0c,0xa1,0xe1,0x9c,
+            0x7d,0x77,0x3d,0x00,0xc1,0x44,0xc5,0x25,
+            0xac,0x61,0x9d,0x18,0xc8,0x4a,0x3f,0x47,
+            0x18,0xe2,0x44,0x8b,0x2f,0xe3,0x24,0xd9,
+            0xcc,0xda,0x27,0x10
+         };
+         const uint8_t tag[16] = {
+            0x25,0x19,0x49,0x8e,0x80,0xf1,0x47,0x8f,
+            0x37,0xba,0x55,0xbd,0x6d,0x27,0x61,0x8c
+         };
+         TGCM gcm(gcmkey);
+         return AES::gcm(gcm, gcmiv, gcmaad, 20, gcmplain, cipher, 60, tag);
+      }
+
+      template<typename TGCM>
+      INLINE static bool gcm256()
+      {
+         // NIST GCM Test Case 16
+         const uint8_t cipher[60] = {
+            0x52,0x2d,0xc1,0xf0,0x99,0x56,0x7d,0x07,
+            0xf4,0x7f,0x37,0xa3,0x2a,0x84,0x42,0x7d,
+            0x64,0x3a,0x8c,0xdc,0xbf,0xe5,0xc0,0xc9,
+            0x75,0x98,0xa2,0xbd,0x25,0x55,0xd1,0xaa,
+            0x8c,0xb0,0x8e,0x48,0x59,0x0d,0xbb,0x3d,
+            0xa7,0xb0,0x8b,0x10,0x56,0x82,0x88,0x38,
+            0xc5,0xf6,0x1e,0x63,0x93,0xba,0x7a,0x0a,
+            0xbc,0xc9,0xf6,0x62
+         };
+         const uint8_t tag[16] = {
+            0x76,0xfc,0x6e,0xce,0x0f,0x4e,0x17,0x68,
+            0xcd,0xdf,0x88,0x53,0xbb,0x2d,0x55,0x1b
+         };
+         TGCM gcm(gcmkey);
+         return AES::gcm(gcm, gcmiv, gcmaad, 20, gcmplain, cipher, 60, tag);
+      }
+
+      /// <summary>
+      /// Compares two GCM implementations on all lengths from 0 to 40 blocks
+      /// and with different aad lengths, including in-place operation.
+      /// </summary>
+      template<typename TGCM1, typename TGCM2>
+      INLINE static bool gcmbulk(const void* key)
+      {
+         constexpr size_t MAXLEN = 40U*16U;
+         uint8_t in  [MAXLEN];
+         uint8_t out1[MAXLEN];
+         uint8_t out2[MAXLEN];
+         uint8_t tag1[16];
+         uint8_t tag2[16];
+
+         for (size_t i = 0; i < sizeof(in); i++)
+            in[i] = (uint8_t)(i * 7U + 3U);
+
+         TGCM1 gcm1(key);
+         TGCM2 gcm2(key);
+
+         for (size_t len = 0; len <= MAXLEN; len++)
+         {
+            const size_t aadlen = (len * 13U) % 300U;
+            gcm1.encrypt(gcmiv, in + 1, aadlen, in, out1, len, tag1);
+            gcm2.encrypt(gcmiv, in + 1, aadlen, in, out2, len, tag2);
+            if (::memcmp(out1, out2, len) != 0 || ::memcmp(tag1, tag2, 16) != 0)
+               return false;
+            if (!gcm1.decrypt(gcmiv, in + 1, aadlen, out1, out1, len, tag2))
+               return false;
+            if (::memcmp(in, out1, len) != 0)
+               return false;
+         }
+         return true;
+      }
+   #if defined(CPPCORE_CPUFEAT_AES) && defined(CPPCORE_CPUFEAT_SSE41) && defined(CPPCORE_CPUFEAT_PCLMUL)
+      INLINE static bool gcmbulk128s() { return gcmbulk<CppCore::AES128GCMs, CppCore::AES128GCMg>(key128); }
+      INLINE static bool gcmbulk192s() { return gcmbulk<CppCore::AES192GCMs, CppCore::AES192GCMg>(key192); }
+      INLINE static bool gcmbulk256s() { return gcmbulk<CppCore::AES256GCMs, CppCore::AES256GCMg>(key256); }
+   #endif
    };
 }}}
 
@@ -554,6 +800,20 @@ namespace CppCore { namespace Test { namespace VS { namespace Crypto {
       TEST_METHOD(CTR128S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::ctr128<CppCore::AES128s>()); }
       TEST_METHOD(CTR192S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::ctr192<CppCore::AES192s>()); }
       TEST_METHOD(CTR256S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::ctr256<CppCore::AES256s>()); }
+      TEST_METHOD(BULK128S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::bulk128s()); }
+      TEST_METHOD(BULK192S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::bulk192s()); }
+      TEST_METHOD(BULK256S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::bulk256s()); }
+   #endif
+      TEST_METHOD(GCM128G) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm128<CppCore::AES128GCMg>()); }
+      TEST_METHOD(GCM192G) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm192<CppCore::AES192GCMg>()); }
+      TEST_METHOD(GCM256G) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm256<CppCore::AES256GCMg>()); }
+   #if defined(CPPCORE_CPUFEAT_AES) && defined(CPPCORE_CPUFEAT_SSE41) && defined(CPPCORE_CPUFEAT_PCLMUL)
+      TEST_METHOD(GCM128S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm128<CppCore::AES128GCMs>()); }
+      TEST_METHOD(GCM192S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm192<CppCore::AES192GCMs>()); }
+      TEST_METHOD(GCM256S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcm256<CppCore::AES256GCMs>()); }
+      TEST_METHOD(GCMBULK128S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcmbulk128s()); }
+      TEST_METHOD(GCMBULK192S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcmbulk192s()); }
+      TEST_METHOD(GCMBULK256S) { Assert::AreEqual(true, CppCore::Test::Crypto::AES::gcmbulk256s()); }
    #endif
    };
 }}}}
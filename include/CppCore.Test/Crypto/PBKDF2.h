@@ -93,6 +93,70 @@ namespace CppCore { namespace Test { namespace Crypto
          return true;
       }
 
+      INLINE static bool sha512test2mt()
+      {
+         uint8_t digest[67];
+         uint8_t expect[67] = {
+            0xda,0xa1,0x8c,0x6d,0xf3,0xd8,0x71,0x1e,
+            0x1b,0x71,0xca,0x4e,0xcb,0x59,0x59,0xa6,
+            0x9a,0xd0,0x4d,0xfa,0xf7,0xfb,0x2a,0x67,
+            0x68,0x60,0xd8,0x43,0x5f,0xca,0x64,0x51,
+            0x88,0xb3,0x13,0xf0,0xe0,0x24,0x81,0xba,
+            0x0b,0xd0,0xf6,0x8b,0xf7,0x49,0xe4,0xc9,
+            0x04,0xec,0xe0,0xb9,0x23,0xe8,0x3d,0x4a,
+            0x19,0xee,0x39,0x58,0xb9,0x0b,0x72,0xd9,
+            0xf5,0xf5,0x8a
+         };
+
+         Thread::Pool<> pool(2);
+         PBKDF2SHA512 pbkdf2;
+         pbkdf2.create("EHjwij3ht8zaDhj", 15, "eDjr4hje", 8, 1000, digest, sizeof(digest), pool);
+         pool.stop();
+
+         if (::memcmp(digest, expect, 67) != 0)
+            return false;
+
+         return true;
+      }
+
+      INLINE static bool sha256test2mt()
+      {
+         uint8_t digest[400];
+         uint8_t expect[400];
+
+         PBKDF2SHA256 pbkdf2;
+         pbkdf2.create("EHjwij3ht8zaDhj", 15, "eDjr4hje", 8, 100, expect, sizeof(expect));
+
+         // more blocks than computed at once and called from the only
+         // thread of the pool, which must not wait on itself
+         Thread::Pool<> pool(1);
+         atomic<bool> done(false);
+         Runnable runnable([&]()
+         {
+            pbkdf2.create("EHjwij3ht8zaDhj", 15, "eDjr4hje", 8, 100, digest, sizeof(digest), pool);
+            done = true;
+         });
+         pool.schedule(runnable);
+         for (size_t i = 0; i < 10000 && !done; i++)
+            ::std::this_thread::sleep_for(milliseconds(1));
+         if (!done)
+            return false;
+         pool.stop();
+
+         if (::memcmp(digest, expect, sizeof(digest)) != 0)
+            return false;
+
+         // from a foreign thread on a larger pool
+         Thread::Pool<> pool4(4);
+         ::memset(digest, 0, sizeof(digest));
+         pbkdf2.create("EHjwij3ht8zaDhj", 15, "eDjr4hje", 8, 100, digest, sizeof(digest), pool4);
+         pool4.stop();
+
+         if (::memcmp(digest, expect, sizeof(digest)) != 0)
+            return false;
+
+         return true;
+      }
    };
 }}}
 
@@ -109,6 +173,8 @@ namespace CppCore { namespace Test { namespace VS { namespace Crypto {
       TEST_METHOD(SHA256TEST1) { Assert::AreEqual(true, CppCore::Test::Crypto::PBKDF2::sha256test1()); }
       TEST_METHOD(SHA512TEST1) { Assert::AreEqual(true, CppCore::Test::Crypto::PBKDF2::sha512test1()); }
       TEST_METHOD(SHA512TEST2) { Assert::AreEqual(true, CppCore::Test::Crypto::PBKDF2::sha512test2()); }
+      TEST_METHOD(SHA512TEST2MT) { Assert::AreEqual(true, CppCore::Test::Crypto::PBKDF2::sha512test2mt()); }
+      TEST_METHOD(SHA256TEST2MT) { Assert::AreEqual(true, CppCore::Test::Crypto::PBKDF2::sha256test2mt()); }
    };
 }}}}
 #endif
@@ -178,6 +178,50 @@ namespace CppCore { namespace Test
             // TODO: More than Base10
             return true;
          }
+         template<typename UINT>
+         INLINE static bool tostringx()
+         {
+            // compares chunked/divide and conquer conversion against one division per symbol
+            const char* alphabets[] = {
+               CPPCORE_ALPHABET_B10, CPPCORE_ALPHABET_B16, CPPCORE_ALPHABET_B62, "01", "0123456" };
+            CppCore::Random::Default32 rnd;
+            CPPCORE_ALIGN_OPTIM(UINT) v;
+            CPPCORE_ALIGN_OPTIM(UINT) t;
+            uint32_t* p = (uint32_t*)&v;
+            char s[sizeof(UINT)*8U+1U];
+            std::string ss, e;
+            for (size_t i = 0; i < 64U; i++)
+            {
+               // random, zero, all bits set and random with leading zero limbs
+               for (size_t j = 0; j < sizeof(UINT)/4U; j++)
+                  p[j] = (i == 1U) ? 0U : (i == 2U) ? 0xFFFFFFFFU : rnd.next();
+               if (i > 2U)
+                  for (size_t j = (size_t)(rnd.next() % (sizeof(UINT)/4U+1U)); j < sizeof(UINT)/4U; j++)
+                     p[j] = 0U;
+               for (const char* alphabet : alphabets)
+               {
+                  const uint32_t base = (uint32_t)::strlen(alphabet);
+                  uint32_t r;
+                  bool z;
+                  e.clear();
+                  CppCore::clone(t, v);
+                  do {
+                     z = CppCore::udivmod_testzero(t, base, t, r);
+                     e.insert(e.begin(), alphabet[r]);
+                  } while (!z);
+                  ss.clear(); CppCore::BaseX::tostring(v, ss, base, alphabet);
+                  if (ss != e) return false;
+                  if ((intptr_t)(sizeof(s)-e.length()) != CppCore::BaseX::tostring(v, s, sizeof(s), base, alphabet, true))
+                     return false;
+                  if (e != s)
+                     return false;
+               }
+            }
+            return true;
+         }
+         INLINE static bool tostring128()  { return tostringx<uint128_t>();  }
+         INLINE static bool tostring1024() { return tostringx<uint1024_t>(); }
+         INLINE static bool tostring4096() { return tostringx<uint4096_t>(); }
          INLINE static bool parse8()
          {
             uint8_t r;
@@ -243,6 +287,60 @@ namespace CppCore { namespace Test
             CppCore::BaseX::parse("340282366920938463463374607431768211456", r, CPPCORE_ALPHABET_B10); if (r[1] != 0U || r[0] != 0U) return false;
             return true;
          }
+         template<typename UINT>
+         INLINE static bool tryparsex()
+         {
+            // round trips with tostring() and checks invalid symbols and overflow in any chunk
+            const char* alphabets[] = {
+               CPPCORE_ALPHABET_B10, CPPCORE_ALPHABET_B16, CPPCORE_ALPHABET_B62, "01", "0123456" };
+            CppCore::Random::Default32 rnd;
+            CPPCORE_ALIGN_OPTIM(UINT) v;
+            CPPCORE_ALIGN_OPTIM(UINT) r;
+            uint32_t* p = (uint32_t*)&v;
+            std::string ss;
+            for (size_t i = 0; i < 64U; i++)
+            {
+               // random, zero, all bits set and random with leading zero limbs
+               for (size_t j = 0; j < sizeof(UINT)/4U; j++)
+                  p[j] = (i == 1U) ? 0U : (i == 2U) ? 0xFFFFFFFFU : rnd.next();
+               if (i > 2U)
+                  for (size_t j = (size_t)(rnd.next() % (sizeof(UINT)/4U+1U)); j < sizeof(UINT)/4U; j++)
+                     p[j] = 0U;
+               for (const char* alphabet : alphabets)
+               {
+                  ss = CppCore::BaseX::tostring(v, alphabet);
+                  if (!CppCore::BaseX::tryparse(ss.c_str(), r, alphabet) || !CppCore::Memory::equal(&r, &v, sizeof(UINT)))
+                     return false;
+                  CppCore::BaseX::parse(ss.c_str(), r, alphabet);
+                  if (!CppCore::Memory::equal(&r, &v, sizeof(UINT)))
+                     return false;
+                  // leading zero symbols
+                  ss.insert(0, 21U, alphabet[0]);
+                  if (!CppCore::BaseX::tryparse(ss.c_str(), r, alphabet) || !CppCore::Memory::equal(&r, &v, sizeof(UINT)))
+                     return false;
+                  // invalid symbol anywhere
+                  ss[rnd.next() % ss.length()] = '-';
+                  if (CppCore::BaseX::tryparse(ss.c_str(), r, alphabet))
+                     return false;
+               }
+            }
+            // max fits, max+1 and more symbols overflow
+            CppCore::bytedup(0xFF, v);
+            ss = CppCore::BaseX::tostring(v, CPPCORE_ALPHABET_B10);
+            if (!CppCore::BaseX::tryparse(ss.c_str(), r, CPPCORE_ALPHABET_B10) || !CppCore::Memory::equal(&r, &v, sizeof(UINT)))
+               return false;
+            ss.back()++;
+            if (CppCore::BaseX::tryparse(ss.c_str(), r, CPPCORE_ALPHABET_B10))
+               return false;
+            ss.back()--;
+            ss += '0';
+            if (CppCore::BaseX::tryparse(ss.c_str(), r, CPPCORE_ALPHABET_B10))
+               return false;
+            return true;
+         }
+         INLINE static bool tryparse256()  { return tryparsex<uint256_t>();  }
+         INLINE static bool tryparse1024() { return tryparsex<uint1024_t>(); }
+         INLINE static bool tryparse4096() { return tryparsex<uint4096_t>(); }
          INLINE static bool tryparse8()
          {
             uint8_t r;
@@ -747,6 +845,56 @@ namespace CppCore { namespace Test
                return false; // invalid symbol '!' at index 25
             return true;
          }
+         INLINE static bool bulk(bool url)
+         {
+            // compares all lengths crossing the simd block sizes against a plain
+            // scalar encoding and tries an invalid symbol at every position
+            const char* tbl = url ? CppCore::Base64::BINTOB64_URL : CppCore::Base64::BINTOB64_STD;
+            const char inv[] = { '#', ':', '@', '[', '`', '{', (char)0x00, (char)0x80, (char)0xFF, url ? '+' : '-', url ? '/' : '_' };
+            uint8_t bin[200];
+            uint8_t dec[200];
+            char enc[272];
+            char exp[272];
+            for (size_t i = 0; i < sizeof(bin); i++)
+               bin[i] = (uint8_t)(i * 167U + 13U);
+            for (size_t len = 1; len <= sizeof(bin); len++)
+            {
+               size_t n = 0;
+               for (size_t i = 0; i < len; i += 3)
+               {
+                  const size_t   r = len - i;
+                  const uint32_t v = (bin[i] << 16) | (r > 1 ? bin[i+1] << 8 : 0) | (r > 2 ? bin[i+2] : 0);
+                  exp[n++] = tbl[(v >> 18) & 0x3F];
+                  exp[n++] = tbl[(v >> 12) & 0x3F];
+                  if (r > 1)     exp[n++] = tbl[(v >> 6) & 0x3F];
+                  else if (!url) exp[n++] = '=';
+                  if (r > 2)     exp[n++] = tbl[v & 0x3F];
+                  else if (!url) exp[n++] = '=';
+               }
+               if (n != CppCore::Base64::symbollength(len, url))
+                  return false;
+               CppCore::Base64::encode(bin, len, enc, url, true);
+               if (::memcmp(enc, exp, n) != 0 || enc[n] != 0x00)
+                  return false;
+               ::memset(dec, 0, sizeof(dec));
+               if (!CppCore::Base64::decode(enc, n, dec, url) || ::memcmp(dec, bin, len) != 0)
+                  return false;
+               for (size_t i = 0; i < n; i++)
+               {
+                  const char c = enc[i];
+                  for (size_t j = 0; j < sizeof(inv); j++)
+                  {
+                     enc[i] = inv[j];
+                     if (CppCore::Base64::decode(enc, n, dec, url))
+                        return false;
+                  }
+                  enc[i] = c;
+               }
+            }
+            return true;
+         }
+         INLINE static bool bulk_std() { return bulk(false); }
+         INLINE static bool bulk_url() { return bulk(true);  }
       };
       class Decimal
       {
@@ -1230,6 +1378,9 @@ namespace CppCore { namespace Test { namespace VS
       TEST_METHOD(BASEX_TOSTRING16) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring16()); }
       TEST_METHOD(BASEX_TOSTRING32) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring32()); }
       TEST_METHOD(BASEX_TOSTRING64) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring64()); }
+      TEST_METHOD(BASEX_TOSTRING128)  { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring128()); }
+      TEST_METHOD(BASEX_TOSTRING1024) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring1024()); }
+      TEST_METHOD(BASEX_TOSTRING4096) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tostring4096()); }
       TEST_METHOD(BASEX_PARSE8)     { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::parse8()); }
       TEST_METHOD(BASEX_PARSE16)    { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::parse16()); }
       TEST_METHOD(BASEX_PARSE32)    { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::parse32()); }
@@ -1240,6 +1391,9 @@ namespace CppCore { namespace Test { namespace VS
       TEST_METHOD(BASEX_TRYPARSE32) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse32()); }
       TEST_METHOD(BASEX_TRYPARSE64) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse64()); }
       TEST_METHOD(BASEX_TRYPARSE128){ Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse128()); }
+      TEST_METHOD(BASEX_TRYPARSE256)  { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse256()); }
+      TEST_METHOD(BASEX_TRYPARSE1024) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse1024()); }
+      TEST_METHOD(BASEX_TRYPARSE4096) { Assert::AreEqual(true, CppCore::Test::Encoding::BaseX::tryparse4096()); }
       TEST_METHOD(HEX_ENCODE)       { Assert::AreEqual(true, CppCore::Test::Encoding::Hex::encode()); }
       TEST_METHOD(HEX_DECODE)       { Assert::AreEqual(true, CppCore::Test::Encoding::Hex::decode()); }
       TEST_METHOD(HEX_TOSTRING16)   { Assert::AreEqual(true, CppCore::Test::Encoding::Hex::tostring16()); }
@@ -1254,6 +1408,8 @@ namespace CppCore { namespace Test { namespace VS
       TEST_METHOD(BASE64_ENCODE_URL)   { Assert::AreEqual(true, CppCore::Test::Encoding::Base64::encode_url()); }
       TEST_METHOD(BASE64_DECODE_STD)   { Assert::AreEqual(true, CppCore::Test::Encoding::Base64::decode_std()); }
       TEST_METHOD(BASE64_DECODE_URL)   { Assert::AreEqual(true, CppCore::Test::Encoding::Base64::decode_url()); }
+      TEST_METHOD(BASE64_BULK_STD)     { Assert::AreEqual(true, CppCore::Test::Encoding::Base64::bulk_std()); }
+      TEST_METHOD(BASE64_BULK_URL)     { Assert::AreEqual(true, CppCore::Test::Encoding::Base64::bulk_url()); }
       TEST_METHOD(DEC_TOSTRING8U)   { Assert::AreEqual(true, CppCore::Test::Encoding::Decimal::tostring8u()); }
       TEST_METHOD(DEC_TOSTRING8S)   { Assert::AreEqual(true, CppCore::Test::Encoding::Decimal::tostring8s()); }
       TEST_METHOD(DEC_TOSTRING16U)  { Assert::AreEqual(true, CppCore::Test::Encoding::Decimal::tostring16u()); }
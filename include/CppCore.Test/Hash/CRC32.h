@@ -62,6 +62,50 @@ namespace CppCore { namespace Test { namespace Hash
          if (!ok || hash != 0x8981D14D) return false;
          return true;
       }
+
+      /// <summary>
+      /// Compares TCRC against bytewise processing using the table of TREF.
+      /// Covers all slicing tails, unaligned input and streaming in uneven pieces.
+      /// </summary>
+      template<typename TCRC, typename TREF = TCRC>
+      INLINE static bool crc32bulk()
+      {
+         uint8_t data[1024+16];
+         for (size_t i = 0; i < sizeof(data); i++)
+            data[i] = (uint8_t)(i * 167U + 13U);
+         for (size_t len = 0; len <= 1024; len += (len < 64) ? 1 : 61)
+         {
+            for (size_t off = 0; off < 16; off += 5)
+            {
+               const uint8_t* mem = data + off;
+               uint32_t ref = TREF::INIT;
+               for (size_t i = 0; i < len; i++)
+                  ref = (ref >> 8) ^ TREF::TABLE[(ref ^ mem[i]) & 0xFF];
+               ref ^= TREF::XOROUT;
+
+               TCRC crc;
+               CppCore::CRC32::Digest hash;
+               crc.hash(mem, len, hash);
+               if (hash != ref)
+                  return false;
+
+               crc.reset();
+               size_t pos = 0;
+               size_t piece = 1;
+               while (pos < len)
+               {
+                  const size_t n = (piece < len - pos) ? piece : len - pos;
+                  crc.step(mem + pos, n);
+                  pos += n;
+                  piece = piece * 3U + 1U;
+               }
+               crc.finish(hash);
+               if (hash != ref)
+                  return false;
+            }
+         }
+         return true;
+      }
    };
 }}}
 
@@ -80,7 +124,10 @@ namespace CppCore { namespace Test { namespace VS { namespace Hash
       TEST_METHOD(CRC32CGTEST1) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest1<CppCore::CRC32Cg>()); }
       TEST_METHOD(CRC32CGTEST2) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest2<CppCore::CRC32Cg>()); }
       TEST_METHOD(CRC32CGTEST3) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest3<CppCore::CRC32Cg>()); }
+      TEST_METHOD(CRC32GBULK)   { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32g>()); }
+      TEST_METHOD(CRC32CGBULK)  { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32Cg>()); }
 #if defined(CPPCORE_CPUFEAT_SSE42)
+      TEST_METHOD(CRC32CSBULK)  { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32Cs, CppCore::CRC32Cg>()); }
       TEST_METHOD(CRC32CSTEST1) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest1<CppCore::CRC32Cs>()); }
       TEST_METHOD(CRC32CSTEST2) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest2<CppCore::CRC32Cs>()); }
       TEST_METHOD(CRC32CSTEST3) { Assert::AreEqual(true, CppCore::Test::Hash::CRC32::crc32ctest3<CppCore::CRC32Cs>()); }
@@ -0,0 +1,358 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+namespace CppCore { namespace Test
+{
+   /// <summary>
+   /// Tests for Logger.h in CppCore
+   /// </summary>
+   class Logger
+   {
+   public:
+      /// <summary>
+      /// Handler that never runs the log timer, so only flush() writes.
+      /// </summary>
+      class NoPool : public CppCore::Handler
+      {
+      };
+
+      /// <summary>
+      /// Logger writing into a string instead of console and file.
+      /// </summary>
+      class Capture : public CppCore::Logger
+      {
+      public:
+         using CppCore::Logger::MAXSTRING;
+         using CppCore::Logger::MAXRECORD;
+         string mOut;
+         INLINE Capture(Handler& pool) : CppCore::Logger(pool, true, false) { }
+         INLINE ~Capture() { flush(); }
+         INLINE size_t usedRings() const
+         {
+            size_t n = 0;
+            for (size_t i = 0; i < CPPCORE_LOG_THREADS; i++)
+               n += mRings[i].mUsed.load() ? 1U : 0U;
+            return n;
+         }
+         INLINE void write(const Chunk* chunks, const size_t num) override
+         {
+            for (size_t i = 0; i < num; i++)
+               mOut.append(chunks[i].Data, chunks[i].Length);
+         }
+      };
+
+      /// <summary>
+      /// Splits output into the messages behind the || of each line.
+      /// Skips the startup line of the logger.
+      /// </summary>
+      INLINE static ::std::vector<string> messages(const string& out)
+      {
+         ::std::vector<string> v;
+         size_t s = 0;
+         while (s < out.length())
+         {
+            size_t e = out.find('\n', s);
+            if (e == string::npos)
+               e = out.length();
+            const size_t m = out.find("||", s);
+            if (m < e)
+            {
+               string msg = out.substr(m + 2U, e - m - 2U);
+               if (msg != "Created Logger")
+                  v.push_back(::std::move(msg));
+            }
+            s = e + 1U;
+         }
+         return v;
+      }
+
+      /// <summary>
+      /// Every argument type and the line layout
+      /// </summary>
+      INLINE static bool formats()
+      {
+         NoPool pool;
+         Capture log(pool);
+         const string str = "str";
+         const char* cstr = "cstr";
+         char* nstr = nullptr;
+         enum E { A, B, C };
+
+         CPPCORE_LOG(log, CppCore::Logger::Channel::Network, CppCore::Logger::Type::Warning,
+            "b={} {} c={} i={} {} u={} {}", true, false, 'x', -42, (int64_t)INT64_MIN, 7U, (uint64_t)UINT64_MAX);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "d={} {} {}", 0.5, -1.25f, 1e300);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "s={} {} {} {} e={}", str, cstr, nstr, string_view("sv"), C);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "p={} {}", (void*)0x1234ABCD, (const int*)nullptr);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "less {} {} args", 1);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "more {} args", 1, 2);
+         CPPCORE_LOG(log, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info,
+            "none");
+         if (!log.log("message", CppCore::Logger::Channel::Data, CppCore::Logger::Type::Error))
+            return false;
+         log.flush();
+
+         const ::std::vector<string> v = messages(log.mOut);
+         if (v.size() != 8U ||
+            v[0] != "b=true false c=x i=-42 -9223372036854775808 u=7 18446744073709551615" ||
+            v[1] != "d=0.5 -1.25 1.0000000000000001e+300" ||
+            v[2] != "s=str cstr (null) sv e=2" ||
+            v[3] != "p=0x000000001234ABCD 0x0000000000000000" ||
+            v[4] != "less 1 {} args" ||
+            v[5] != "more 1 args" ||
+            v[6] != "none" ||
+            v[7] != "message")
+            return false;
+
+         // channel and type of lines, date and time in front
+         const size_t NET = log.mOut.find("|NET|WRN||b=true");
+         const size_t DAT = log.mOut.find("|DAT|ERR||message\n");
+         return NET != string::npos && DAT != string::npos &&
+            log.mOut[4] == '/' && log.mOut[10] == '|' && log.mOut[13] == ':';
+      }
+
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// Threads log with log() and logf() while another one flushes.
+      /// All lines must arrive and keep their order per thread.
+      /// </summary>
+      INLINE static bool mt()
+      {
+         constexpr size_t THREADS = 4;
+         constexpr size_t N = 5000;
+
+         NoPool pool;
+         Capture log(pool);
+         atomic<size_t> done(0);
+         ::std::thread producers[THREADS];
+
+         for (size_t t = 0; t < THREADS; t++)
+            producers[t] = ::std::thread([&log, &done, t]() {
+               for (size_t i = 0; i < N; i++)
+               {
+                  // retry while ring is full
+                  if (i & 1U)
+                  {
+                     while (!log.log(::std::to_string(t) + " " + ::std::to_string(i)))
+                        ::std::this_thread::yield();
+                  }
+                  else
+                  {
+                     bool ok;
+                     do {
+                        static constexpr CppCore::Logger::Format FORMAT = { "{} {}" };
+                        ok = log.logf(FORMAT, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info, t, i);
+                        if (!ok) ::std::this_thread::yield();
+                     } while (!ok);
+                  }
+               }
+               done++;
+            });
+
+         while (done.load() != THREADS)
+            log.flush();
+         for (size_t t = 0; t < THREADS; t++)
+            producers[t].join();
+         log.flush();
+
+         size_t next[THREADS] = { };
+         for (const string& m : messages(log.mOut))
+         {
+            size_t t, i;
+            if (::sscanf(m.c_str(), "%zu %zu", &t, &i) != 2 || t >= THREADS || i != next[t])
+               return false;
+            next[t]++;
+         }
+         for (size_t t = 0; t < THREADS; t++)
+            if (next[t] != N)
+               return false;
+         return true;
+      }
+   #endif
+
+      /// <summary>
+      /// Fills the ring until it is full, several times with varying record
+      /// sizes, so records wrap around at different offsets.
+      /// </summary>
+      INLINE static bool ring()
+      {
+         NoPool pool;
+         Capture log(pool);
+         size_t seq = 0;
+
+         for (size_t round = 0; round < 8; round++)
+         {
+            const size_t FIRST = seq;
+            string pad;
+
+            // until ring is full
+            while (true)
+            {
+               pad.assign((seq * 37U + round * 101U) % 300U, 'p');
+               static constexpr CppCore::Logger::Format FORMAT = { "{} {}" };
+               if (!log.logf(FORMAT, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info, seq, pad))
+                  break;
+               seq++;
+            }
+
+            // nothing was lost and everything fits again afterwards
+            if (seq - FIRST < 100U)
+               return false;
+            log.mOut.clear();
+            log.flush();
+            const ::std::vector<string> v = messages(log.mOut);
+            if (v.size() != seq - FIRST)
+               return false;
+            for (size_t i = 0; i < v.size(); i++)
+               if (v[i] != ::std::to_string(FIRST + i) + " " + string(((FIRST + i) * 37U + round * 101U) % 300U, 'p'))
+                  return false;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// Strings longer than MAXSTRING are cut, records above MAXRECORD fail.
+      /// </summary>
+      INLINE static bool longstring()
+      {
+         NoPool pool;
+         Capture log(pool);
+         const string EXACT(Capture::MAXSTRING, 'a');
+         const string LONG(Capture::MAXSTRING + 1000U, 'b');
+
+         if (!log.log(EXACT) || !log.log(LONG))
+            return false;
+
+         // two cut strings exceed a record
+         static constexpr CppCore::Logger::Format FORMAT = { "{}{}" };
+         if (log.logf(FORMAT, CppCore::Logger::Channel::App, CppCore::Logger::Type::Info, LONG, LONG))
+            return false;
+
+         log.flush();
+         const ::std::vector<string> v = messages(log.mOut);
+         return v.size() == 2U && v[0] == EXACT && v[1] == LONG.substr(0, Capture::MAXSTRING);
+      }
+
+      /// <summary>
+      /// One thread logs alternately into two loggers whose ids map to
+      /// the same cache entry. Both must keep their ring of the thread.
+      /// </summary>
+      INLINE static bool loggers()
+      {
+         NoPool pool;
+         ::std::unique_ptr<Capture> logs[5];
+         for (size_t i = 0; i < 5; i++)
+            logs[i].reset(new Capture(pool));
+         Capture& a = *logs[0];
+         Capture& b = *logs[4];
+
+         for (size_t i = 0; i < 500; i++)
+         {
+            if (!a.log("a " + ::std::to_string(i)) || !b.log("b " + ::std::to_string(i)))
+               return false;
+            if (i % 100U == 99U)
+            {
+               a.flush();
+               b.flush();
+            }
+         }
+         if (a.usedRings() != 1U || b.usedRings() != 1U)
+            return false;
+
+         a.flush();
+         b.flush();
+         const ::std::vector<string> va = messages(a.mOut);
+         const ::std::vector<string> vb = messages(b.mOut);
+         if (va.size() != 500U || vb.size() != 500U)
+            return false;
+         for (size_t i = 0; i < 500; i++)
+            if (va[i] != "a " + ::std::to_string(i) || vb[i] != "b " + ::std::to_string(i))
+               return false;
+         return a.getDropped() == 0U && b.getDropped() == 0U;
+      }
+
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// More threads than CPPCORE_LOG_THREADS log at once. The ones
+      /// without a ring fail and are counted as dropped records.
+      /// </summary>
+      INLINE static bool dropped()
+      {
+         constexpr size_t THREADS = CPPCORE_LOG_THREADS + 4U;
+
+         NoPool pool;
+         Capture log(pool);
+         atomic<size_t> arrived(0);
+         atomic<size_t> failed(0);
+         ::std::unique_ptr<::std::thread[]> threads(new ::std::thread[THREADS]);
+
+         // each keeps its ring until all have logged
+         for (size_t t = 0; t < THREADS; t++)
+            threads[t] = ::std::thread([&log, &arrived, &failed, t]() {
+               if (!log.log(::std::to_string(t)))
+                  failed++;
+               arrived++;
+               while (arrived.load() != THREADS)
+                  ::std::this_thread::yield();
+            });
+         for (size_t t = 0; t < THREADS; t++)
+            threads[t].join();
+
+         // one ring is used by this thread for the startup line
+         constexpr size_t FAILS = THREADS - (CPPCORE_LOG_THREADS - 1U);
+         log.flush();
+         return failed.load() == FAILS && log.getDropped() == FAILS &&
+            messages(log.mOut).size() == THREADS - FAILS;
+      }
+
+      /// <summary>
+      /// Destructor writes pending lines to the file, also those logged
+      /// by threads that exited before.
+      /// </summary>
+      INLINE static bool destructor()
+      {
+         const path FILE = ::std::filesystem::temp_directory_path() / "cppcore_test_logger.log";
+         NoPool pool;
+         {
+            CppCore::Logger log(pool, false, true, FILE);
+            log.log("main");
+            ::std::thread t([&log]() { log.log("thread"); });
+            t.join();
+         }
+         ::std::ifstream f(FILE, ::std::ios::binary);
+         const string out((::std::istreambuf_iterator<char>(f)), ::std::istreambuf_iterator<char>());
+         f.close();
+         ::std::filesystem::remove(FILE);
+         const ::std::vector<string> v = messages(out);
+         return v.size() == 2U && v[0] == "main" && v[1] == "thread";
+      }
+   #endif
+   };
+}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(Logger)
+   {
+   public:
+      TEST_METHOD(FORMATS)    { Assert::AreEqual(true, CppCore::Test::Logger::formats()); }
+      TEST_METHOD(RING)       { Assert::AreEqual(true, CppCore::Test::Logger::ring()); }
+      TEST_METHOD(LONGSTRING) { Assert::AreEqual(true, CppCore::Test::Logger::longstring()); }
+      TEST_METHOD(LOGGERS)    { Assert::AreEqual(true, CppCore::Test::Logger::loggers()); }
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(MT)         { Assert::AreEqual(true, CppCore::Test::Logger::mt()); }
+      TEST_METHOD(DROPPED)    { Assert::AreEqual(true, CppCore::Test::Logger::dropped()); }
+      TEST_METHOD(DESTRUCTOR) { Assert::AreEqual(true, CppCore::Test::Logger::destructor()); }
+   #endif
+   };
+}}}
+#endif
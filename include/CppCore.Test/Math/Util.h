@@ -1193,6 +1193,236 @@ namespace CppCore { namespace Test { namespace Math
          return true;
       }
 
+      template<typename UINT>
+      INLINE static bool umulk()
+      {
+         constexpr size_t N32 = sizeof(UINT) / 4;
+         struct UINTX2 { UINT x[2]; };
+         CppCore::Random::Default32 rnd;
+         UINT   a, b, l1, l2;
+         UINTX2 r1, r2;
+         uint32_t ap[N32], bp[N32];
+         for (size_t j = 0; j < 1000; j++)
+         {
+            // random, all bits set or zero limbs to hit all carries in the middle terms
+            for (size_t i = 0; i < N32; i++)
+            {
+               const uint32_t m = rnd.next() % 4U;
+               ap[i] = (j & 1U) ? 0xFFFFFFFFU : (m == 0U) ? 0U : rnd.next();
+               bp[i] = (j & 2U) ? 0xFFFFFFFFU : (m == 1U) ? 0U : rnd.next();
+            }
+            ::memcpy((void*)&a, ap, sizeof(a));
+            ::memcpy((void*)&b, bp, sizeof(b));
+
+            // full a*b
+            CppCore::umul(a, b, r1);
+            CppCore::umulk(a, b, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINTX2)) != 0)
+               return false;
+
+            // lower half a*b
+            CppCore::umul(a, b, l1);
+            CppCore::umulk(a, b, l2);
+            if (::memcmp(&l1, &l2, sizeof(UINT)) != 0)
+               return false;
+
+            // a*a
+            CppCore::umul(a, a, r1);
+            CppCore::usquare(a, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINTX2)) != 0)
+               return false;
+         }
+         return true;
+      }
+
+      template<typename UINT>
+      INLINE static bool montgomery()
+      {
+         constexpr size_t N32 = sizeof(UINT) / 4;
+         CppCore::Random::Default32 rnd;
+         CppCore::Montgomery<UINT> mt;
+         UINT n, a, b, e, x, y, r1, r2;
+         UINT mem[2];
+         uint32_t np[N32], ap[N32], bp[N32], ep[N32];
+         for (size_t j = 0; j < 1000; j++)
+         {
+            // random odd modulus, every other one with highest bit set
+            for (size_t i = 0; i < N32; i++)
+            {
+               np[i] = rnd.next();
+               ap[i] = rnd.next();
+               bp[i] = rnd.next();
+               ep[i] = 0U;
+            }
+            np[0] |= 1U;
+            if (j & 1U) np[N32-1] |= 0x80000000U;
+            else        np[N32-1] >>= (j % 31U);
+            ep[0] = rnd.next();
+            ::memcpy((void*)&n, np, sizeof(n));
+            ::memcpy((void*)&a, ap, sizeof(a));
+            ::memcpy((void*)&b, bp, sizeof(b));
+            ::memcpy((void*)&e, ep, sizeof(e));
+            mt.reset(n);
+
+            // a*b mod n
+            CppCore::umulmod(a, b, n, r1);
+            mt.to(a, x);
+            mt.to(b, y);
+            mt.mul(x, y, r2);
+            mt.from(r2, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // a*a mod n
+            CppCore::umulmod(a, a, n, r1);
+            mt.square(x, r2);
+            mt.from(r2, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // a^e mod n, reference using umulmod
+            CppCore::umod<UINT, UINT>(x, a, n, mem);
+            r1 = 1U;
+            for (uint32_t i = 0; i < 32U; i++)
+            {
+               if ((ep[0] >> i) & 1U)
+                  CppCore::umulmod(r1, x, n, r1);
+               CppCore::umulmod(x, x, n, x);
+            }
+            CppCore::upowmod(a, e, mt, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+            CppCore::upowmod(a, e, n, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+         }
+         return true;
+      }
+
+      template<typename UINT>
+      INLINE static bool barrett()
+      {
+         constexpr size_t N32 = sizeof(UINT) / 4;
+         CppCore::Random::Default32 rnd;
+         CppCore::Barrett<UINT> br;
+         UINT n, a, b, e, x, r1, r2;
+         UINT mem[2];
+         uint32_t np[N32], ap[N32], bp[N32], ep[N32];
+         for (size_t j = 0; j < 1000; j++)
+         {
+            // random modulus, odd and even, with and without leading zero limbs
+            for (size_t i = 0; i < N32; i++)
+            {
+               np[i] = rnd.next();
+               ap[i] = rnd.next();
+               bp[i] = rnd.next();
+               ep[i] = 0U;
+            }
+            if (j & 1U) np[0] &= ~1U;
+            if (j & 2U) np[N32-1] |= 0x80000000U;
+            else for (size_t i = N32 - (j % N32); i < N32; i++) np[i] = 0U;
+            if (j % 7U == 0U) { for (size_t i = 0; i < N32; i++) np[i] = 0U; np[(j / 7U) % N32] = 1U; }
+            if (j % 11U == 0U) { for (size_t i = 0; i < N32; i++) np[i] = 0xFFFFFFFFU; }
+            if (np[0] == 0U) np[0] = 2U;
+            ep[0] = rnd.next();
+            ::memcpy((void*)&n, np, sizeof(n));
+            ::memcpy((void*)&a, ap, sizeof(a));
+            ::memcpy((void*)&b, bp, sizeof(b));
+            ::memcpy((void*)&e, ep, sizeof(e));
+            br.reset(n);
+
+            // a mod n
+            CppCore::umod<UINT, UINT>(r1, a, n, mem);
+            br.mod(a, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // a*b mod n
+            CppCore::umod<UINT, UINT>(x, b, n, mem);
+            CppCore::umulmod(a, b, n, r1);
+            br.mul(r2, x, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // a*a mod n
+            CppCore::umulmod(a, a, n, r1);
+            br.mod(a, r2);
+            br.square(r2, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // a^e mod n, reference using umulmod
+            CppCore::umod<UINT, UINT>(x, a, n, mem);
+            r1 = (n == 1U) ? 0U : 1U;
+            for (uint32_t i = 0; i < 32U; i++)
+            {
+               if ((ep[0] >> i) & 1U)
+                  CppCore::umulmod(r1, x, n, r1);
+               CppCore::umulmod(x, x, n, x);
+            }
+            CppCore::upowmod(a, e, br, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+            CppCore::upowmod(a, e, n, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+         }
+         return true;
+      }
+
+      template<typename UINT>
+      INLINE static bool upowmod()
+      {
+         constexpr size_t N32 = sizeof(UINT) / 4;
+         constexpr size_t n = 16384U / sizeof(UINT);
+         CppCore::Random::Default32 rnd;
+         UINT m, a, b, x, r1, r2;
+         uint32_t mp[N32], ap[N32], bp[N32];
+         for (size_t j = 0; j < n; j++)
+         {
+            // random modulus with every other one even, exponents of any length
+            for (size_t i = 0; i < N32; i++)
+            {
+               mp[i] = rnd.next();
+               ap[i] = rnd.next();
+               bp[i] = rnd.next();
+            }
+            mp[0] = (j & 1U) ? (mp[0] | 1U) : (mp[0] & ~1U);
+            mp[N32-1] |= 0x80000000U;
+            bp[N32-1] >>= (j % 32U);
+            if (j % 8U == 7U)
+               for (size_t i = 1; i < N32; i++)
+                  bp[i] = 0U;
+            ::memcpy((void*)&m, mp, sizeof(m));
+            ::memcpy((void*)&a, ap, sizeof(a));
+            ::memcpy((void*)&b, bp, sizeof(b));
+
+            // reference bit by bit from right to left
+            CppCore::clone(x, a);
+            CppCore::clear(r1);
+            *(uint32_t*)&r1 = 1U;
+            for (uint32_t i = 0; i < sizeof(UINT)*8U; i++)
+            {
+               if (CppCore::bittest(b, i))
+                  CppCore::umulmod(r1, x, m, r1);
+               CppCore::umulmod(x, x, m, x);
+            }
+
+            // a*a mod m
+            CppCore::umulmod(a, a, m, x);
+            CppCore::usquaremod(a, m, r2);
+            if (::memcmp(&x, &r2, sizeof(UINT)) != 0)
+               return false;
+
+            // sliding window
+            CppCore::clone(x, a);
+            CppCore::upowmod(x, b, m, r2);
+            if (::memcmp(&r1, &r2, sizeof(UINT)) != 0)
+               return false;
+         }
+         return true;
+      }
+
       INLINE static bool ismersenne32()
       {
          if (CppCore::ismersenne32(0) != 0)
@@ -1553,6 +1783,9 @@ namespace CppCore { namespace Test { namespace VS { namespace Math {
       TEST_METHOD(UMULMOD64)        { Assert::AreEqual(true, CppCore::Test::Math::Util::umulmod64()); }
       TEST_METHOD(UPOWMOD32)        { Assert::AreEqual(true, CppCore::Test::Math::Util::upowmod32()); }
       TEST_METHOD(UPOWMOD64)        { Assert::AreEqual(true, CppCore::Test::Math::Util::upowmod64()); }
+      TEST_METHOD(UPOWMOD128)       { Assert::AreEqual(true, CppCore::Test::Math::Util::upowmod<uint128_t>()); }
+      TEST_METHOD(UPOWMOD512)       { Assert::AreEqual(true, CppCore::Test::Math::Util::upowmod<uint512_t>()); }
+      TEST_METHOD(UPOWMOD2048)      { Assert::AreEqual(true, CppCore::Test::Math::Util::upowmod<uint2048_t>()); }
       TEST_METHOD(UPOW32)           { Assert::AreEqual(true, CppCore::Test::Math::Util::upow32()); }
       TEST_METHOD(UPOW64)           { Assert::AreEqual(true, CppCore::Test::Math::Util::upow64()); }
       TEST_METHOD(UDIVMOD32)        { Assert::AreEqual(true, CppCore::Test::Math::Util::udivmod32()); }
@@ -1566,6 +1799,22 @@ namespace CppCore { namespace Test { namespace VS { namespace Math {
       TEST_METHOD(UMOD256_64)       { Assert::AreEqual(true, CppCore::Test::Math::Util::umod<uint256_t, uint64_t> (100000)); }
       TEST_METHOD(UMOD256_128)      { Assert::AreEqual(true, CppCore::Test::Math::Util::umod<uint256_t, uint128_t>(100000)); }
       TEST_METHOD(UMOD256_256)      { Assert::AreEqual(true, CppCore::Test::Math::Util::umod<uint256_t, uint256_t>(100000)); }
+      TEST_METHOD(MONTGOMERY64)     { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint64_t>()); }
+      TEST_METHOD(MONTGOMERY128)    { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint128_t>()); }
+      TEST_METHOD(MONTGOMERY256)    { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint256_t>()); }
+      TEST_METHOD(MONTGOMERY512)    { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint512_t>()); }
+      TEST_METHOD(MONTGOMERY1024)   { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint1024_t>()); }
+      TEST_METHOD(MONTGOMERY2048)   { Assert::AreEqual(true, CppCore::Test::Math::Util::montgomery<uint2048_t>()); }
+      TEST_METHOD(BARRETT64)        { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint64_t>()); }
+      TEST_METHOD(BARRETT128)       { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint128_t>()); }
+      TEST_METHOD(BARRETT256)       { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint256_t>()); }
+      TEST_METHOD(BARRETT512)       { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint512_t>()); }
+      TEST_METHOD(BARRETT1024)      { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint1024_t>()); }
+      TEST_METHOD(BARRETT2048)      { Assert::AreEqual(true, CppCore::Test::Math::Util::barrett<uint2048_t>()); }
+      TEST_METHOD(UMULK256)         { Assert::AreEqual(true, CppCore::Test::Math::Util::umulk<uint256_t>()); }
+      TEST_METHOD(UMULK1024)        { Assert::AreEqual(true, CppCore::Test::Math::Util::umulk<uint1024_t>()); }
+      TEST_METHOD(UMULK2048)        { Assert::AreEqual(true, CppCore::Test::Math::Util::umulk<uint2048_t>()); }
+      TEST_METHOD(UMULK4096)        { Assert::AreEqual(true, CppCore::Test::Math::Util::umulk<uint4096_t>()); }
       TEST_METHOD(UDIVMOD16X)       { Assert::AreEqual(true, CppCore::Test::Math::Util::udivmod16x()); }
       TEST_METHOD(UDIVMOD32X)       { Assert::AreEqual(true, CppCore::Test::Math::Util::udivmod32x()); }
       TEST_METHOD(ISMERSENNE32)     { Assert::AreEqual(true, CppCore::Test::Math::Util::ismersenne32()); }
@@ -76,6 +76,10 @@ namespace CppCore { namespace Test { namespace Network
                 s.setOptionTcpNoDelay(true)   && // enable  TCP_NODELAY
                 s.setOptionLinger(false, 0)   && // disable SO_LINGER
                 s.setOptionKeepAlive(true)    && // enable  SO_KEEPALIVE
+                s.setOptionSendBuffer(8192)   && // set     SO_SNDBUF
+                s.setOptionRecvBuffer(8192)   && // set     SO_RCVBUF
+                s.getOptionSendBuffer() >= 8192 &&
+                s.getOptionRecvBuffer() >= 8192 &&
                 (0 == s.close());                // Close successfully
             s.close();
          }
@@ -156,6 +160,109 @@ namespace CppCore { namespace Test { namespace Network
          CppCore::Socket::Op::shutdownSockets();
          return r;
       }
+
+      INLINE static bool sendvipv4tcp()
+      {
+         CppCore::Socket::Op::initSockets();
+         CppCore::Socket l(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+         CppCore::Socket c(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+         bool r = false;
+         if (l.getSocket() != INVALID_SOCKET && c.getSocket() != INVALID_SOCKET)
+         {
+            sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            addr.sin_port = htons(CPPCORE_TEST_NETWORK_PORT);
+            if (l.setOptionReuseAddress(true) &&
+               SOCKET_ERROR != l.bind((sockaddr*)&addr, sizeof(addr)) && 
+               SOCKET_ERROR != l.listen(16) &&
+               SOCKET_ERROR != c.connect((sockaddr*)&addr, sizeof(addr)))
+            {
+               sockaddr_in from;
+               socklen_t fromlen = sizeof(from);
+               SOCKET a = CppCore::Socket::Op::accept(l.getSocket(), (sockaddr*)&from, &fromlen);
+               if (a != INVALID_SOCKET)
+               {
+                  // gather three buffers into one call, receive them as one stream
+                  char b1[] = "Hello", b2[] = ", ", b3[] = "World!";
+                  char recv[16] = { };
+                  CppCore::Socket::Op::IoVec vecs[3];
+                  CppCore::Socket::Op::setIoVec(vecs[0], b1, 5);
+                  CppCore::Socket::Op::setIoVec(vecs[1], b2, 2);
+                  CppCore::Socket::Op::setIoVec(vecs[2], b3, 6);
+                  int n = 0;
+                  r = c.sendv(vecs, 3) == 13 && c.setOptionTcpCork(false);
+                  while (r && n < 13)
+                  {
+                     const int rc = CppCore::Socket::Op::recv(a, recv + n, 13 - n);
+                     if (rc <= 0) r = false;
+                     else n += rc;
+                  }
+                  r = r && !memcmp(recv, "Hello, World!", 13);
+                  // client closes first so TIME_WAIT stays on its ephemeral
+                  // port instead of the listening one, reruns can bind again
+                  c.close();
+                  CppCore::Socket::Op::close(a);
+               }
+            }
+            c.close();
+            l.close();
+         }
+         CppCore::Socket::Op::shutdownSockets();
+         return r;
+      }
+
+      INLINE static bool dgrambatchipv4udp()
+      {
+         CppCore::Socket::Op::initSockets();
+         CppCore::Socket s(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+         bool r = false;
+         if (s.getSocket() != INVALID_SOCKET && s.setNoBlock(true))
+         {
+            sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            addr.sin_port = htons(CPPCORE_TEST_NETWORK_PORT);
+            if (SOCKET_ERROR != s.bind((sockaddr*)&addr, sizeof(addr)))
+            {
+               // send 8 datagrams of different size to ourself
+               constexpr int N = 8;
+               char out[N][16], in[N+1][16];
+               CppCore::Socket::Op::Datagram d[N+1];
+               for (int i = 0; i < N; i++)
+               {
+                  memset(out[i], 'a' + i, sizeof(out[i]));
+                  d[i].buf = out[i];
+                  d[i].len = i + 1;
+                  memcpy(&d[i].addr, &addr, sizeof(addr));
+                  d[i].addrlen = sizeof(addr);
+               }
+               int sent = s.sendtov(d, N);
+
+               // receive them with one more slot than needed
+               int recv = 0;
+               for (int t = 0; t < 100 && sent == N && recv < N; t++)
+               {
+                  s.poll(POLLIN, 10);
+                  for (int i = 0; i < N + 1; i++)
+                  {
+                     d[i].buf = in[i];
+                     d[i].len = sizeof(in[i]);
+                  }
+                  const int rc = s.recvfromv(d, N + 1 - recv);
+                  for (int i = 0; i < rc; i++, recv++)
+                     if (d[i].len != recv + 1 || memcmp(in[i], out[recv], recv + 1))
+                        sent = 0;
+               }
+               r = sent == N && recv == N && s.recvfromv(d, 1) == SOCKET_ERROR;
+            }
+            s.close();
+         }
+         CppCore::Socket::Op::shutdownSockets();
+         return r;
+      }
    };
 }}}
 
@@ -181,6 +288,9 @@ namespace CppCore { namespace Test { namespace VS { namespace Network {
       TEST_METHOD(BINDIPV4TCP)   { Assert::AreEqual(true, CppCore::Test::Network::Socket::bindlistenipv4tcp()); }
       TEST_METHOD(BINDIPV6TCP)   { Assert::AreEqual(true, CppCore::Test::Network::Socket::bindlistenipv6tcp()); }
       TEST_METHOD(BINDIPV6DSTCP) { Assert::AreEqual(true, CppCore::Test::Network::Socket::bindlistenipv6dstcp()); }
+
+      TEST_METHOD(SENDVIPV4TCP)  { Assert::AreEqual(true, CppCore::Test::Network::Socket::sendvipv4tcp()); }
+      TEST_METHOD(DGRAMBATCHIPV4UDP) { Assert::AreEqual(true, CppCore::Test::Network::Socket::dgrambatchipv4udp()); }
    };
 }}}}
 #endif
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+#ifndef CPPCORE_NO_SOCKET
+
+namespace CppCore { namespace Test { namespace Network
+{
+   /// <summary>
+   /// Tests for TcpLink.h in CppCore
+   /// </summary>
+   class TcpLink
+   {
+   public:
+      using Message = CppCore::TcpLinkMessage<>;
+      using Pool    = CppCore::TcpLinkPool<Message, 256>;
+      using Link    = CppCore::TcpLink<Message, Pool>;
+
+      /// <summary>
+      /// Port of the loopback tests
+      /// </summary>
+      static constexpr uint16_t PORT = 9997;
+
+      /// <summary>
+      /// Counts send events
+      /// </summary>
+      class Counter : public Link::Callback
+      {
+      public:
+         size_t mBlocked;
+         size_t mErrors;
+         INLINE Counter() : mBlocked(0), mErrors(0) { }
+         INLINE void onSendBlocked() override { mBlocked++; }
+         INLINE void onSendError() override { mErrors++; }
+      };
+
+      /// <summary>
+      /// Pops all items of a pool and pushes them back.
+      /// Returns how many there were.
+      /// </summary>
+      INLINE static size_t countFree(Pool& pool)
+      {
+         Message* items[256];
+         size_t n = 0;
+         while (n < 256U && pool.popBack(items[n]))
+            n++;
+         for (size_t i = 0; i < n; i++)
+            pool.pushBack(items[i]);
+         return n;
+      }
+
+      /// <summary>
+      /// Many queued messages through small socket buffers, so sendv()
+      /// returns short writes that end within messages, also repeatedly
+      /// within the same one.
+      /// All bytes must arrive in order and all buffers return to the pool.
+      /// </summary>
+      INLINE static bool shortwrites()
+      {
+         CppCore::Socket::Op::initSockets();
+         ::std::unique_ptr<Pool> pool(new Pool());
+         const bool ok = shortwritesloopback(*pool);
+         CppCore::Socket::Op::shutdownSockets();
+         return ok && countFree(*pool) == 256U;
+      }
+
+      INLINE static bool shortwritesloopback(Pool& pool)
+      {
+         constexpr size_t N = 500;
+         Counter cb;
+         Link link(pool);
+         TcpSocket listener, peer;
+         string sent, recv;
+         char buf[4096];
+
+         if (listener.listen(PORT) != TcpSocket::ListenReturn::OK)
+            return false;
+
+         // small segments keep the receive window opening in small steps,
+         // so remainders of messages get cut again (not on all platforms)
+         listener.setOptionTcpMaxSegment(1400);
+         if (link.connect("127.0.0.1", ::std::to_string(PORT).c_str()) != TcpSocket::ConnectReturn::OK)
+            return false;
+
+         // accept the other end
+         const TimePointHR END = ClockHR::now() + seconds(10);
+         while (!peer.acceptFrom(listener))
+         {
+            if (ClockHR::now() >= END)
+               return false;
+            listener.poll(POLLIN, 16);
+         }
+
+         // small buffers on both ends and cork large bursts
+         if (!link.getSocket().setOptionSendBuffer(4096) || !peer.setOptionRecvBuffer(8192))
+            return false;
+         link.setCork(true);
+
+         size_t next = 0;
+         while ((next < N || recv.length() < sent.length()) && ClockHR::now() < END)
+         {
+            // queue as many messages as there are buffers and queue slots
+            Message* msg;
+            while (next < N && pool.popBack(msg))
+            {
+               string data(1U + (next * 7919U) % 8000U, 0);
+               for (size_t j = 0; j < data.length(); j++)
+                  data[j] = (char)(next + j);
+               msg->clear();
+               msg->writeData(data.c_str(), data.length());
+               if (!link.enqueue(msg))
+               {
+                  pool.pushBack(msg);
+                  break;
+               }
+               sent += data;
+               next++;
+            }
+
+            // send, the socket must never be left corked
+            link.send(cb);
+            if (link.getSocket().getOptionTcpCork())
+               return false;
+
+            // read only after each send so the sender runs full
+            const int rc = peer.recv(buf, (int)sizeof(buf));
+            if (rc > 0)
+               recv.append(buf, (size_t)rc);
+            else if (rc == 0 || !CppCore::Socket::Op::isLastErrorBlock())
+               return false;
+            else
+               peer.poll(POLLIN, 1);
+
+            // recover from send block
+            if (link.isSendBlocked())
+               link.poll(POLLOUT, 0);
+         }
+
+         return next == N && recv == sent && cb.mBlocked > 0U && cb.mErrors == 0U &&
+            link.getBytesSent() == sent.length();
+      }
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Network
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(TcpLink)
+   {
+   public:
+      TEST_METHOD(SHORTWRITES) { Assert::AreEqual(true, CppCore::Test::Network::TcpLink::shortwrites()); }
+   };
+}}}}
+#endif
+#endif
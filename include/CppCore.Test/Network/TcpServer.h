@@ -0,0 +1,349 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+#if !defined(CPPCORE_NO_SOCKET) && !defined(CPPCORE_NO_THREADING)
+
+namespace CppCore { namespace Test { namespace Network
+{
+   /// <summary>
+   /// Tests for TcpServer.h in CppCore
+   /// </summary>
+   class TcpServer
+   {
+   public:
+      using Base    = CppCore::TcpServer<>;
+      using Session = CppCore::TcpSession<>;
+      using Message = CppCore::TcpLinkMessage<>;
+
+      /// <summary>
+      /// Port of the loopback tests
+      /// </summary>
+      static constexpr uint16_t PORT = 9998;
+
+      /// <summary>
+      /// Echoes every message back and remembers accepted sessions
+      /// </summary>
+      class Echo : public Base::Callback
+      {
+      public:
+         atomic<size_t>   mAccepted;
+         atomic<size_t>   mDisconnected;
+         atomic<uint32_t> mLastId;
+         atomic<bool>     mActive[CPPCORE_NETSERVER_MAXCLIENTS];
+         INLINE Echo() : mAccepted(0), mDisconnected(0), mLastId(0), mActive{} { }
+         INLINE void onSessionMessageTcp(Session& session, Message& msg) override
+         {
+            if (Message* out = session.popFreeTcp())
+            {
+               out->clear();
+               out->writeData(msg.getPtr(), msg.getLength());
+               session.sendTcp(out);
+            }
+         }
+         INLINE void onSessionAccepted(Session& session) override
+         {
+            mLastId = session.getId();
+            mActive[session.getId()] = true;
+            mAccepted++;
+         }
+         INLINE void onSessionDisconnected(Session& session) override
+         {
+            mActive[session.getId()] = false;
+            mDisconnected++;
+         }
+      };
+
+      /// <summary>
+      /// Server exposing its reactors
+      /// </summary>
+      class Sharded : public Base
+      {
+      public:
+         using Base::Base;
+         using Base::SESSIONSPERREACTOR;
+         using Base::isListening;
+         INLINE Session& getSession(size_t id) { return mSessions[id]; }
+         INLINE size_t getReactorIndex(const Session& s) { return &getReactor(s) - mReactors; }
+         INLINE bool isOwnedBy(size_t r, const Session& s)
+         {
+            return &s >= mReactors[r].mSessions && &s < mReactors[r].mSessions + SESSIONSPERREACTOR;
+         }
+         INLINE bool isListening(size_t r) { return mReactors[r].mSocketTcp.isUsed(); }
+         INLINE bool isReusePort(size_t r) { return mReactors[r].mSocketTcp.getOptionReusePort(); }
+         INLINE size_t getFree(size_t r) { return mReactors[r].mSessionsFree.length(); }
+         INLINE size_t getFreeCapacity(size_t r) { return mReactors[r].mSessionsFree.size(); }
+      };
+
+      /// <summary>
+      /// Thread pool, logger and server on the loopback port.
+      /// The pool is stopped before the server goes away.
+      /// </summary>
+      template<typename TSERVER>
+      class Env
+      {
+      public:
+         ::std::unique_ptr<Thread::Pool<>> mPool;
+         ::std::unique_ptr<CppCore::Logger> mLogger;
+         Echo mEcho;
+         ::std::unique_ptr<TSERVER> mServer;
+         INLINE Env(const DurationHR& timeoutReceive) :
+            mPool(new Thread::Pool<>(8)),
+            mLogger(new CppCore::Logger(*mPool, false, false)),
+            mServer(new TSERVER(PORT, *mPool, *mPool, *mPool, *mLogger, mEcho, timeoutReceive)) { }
+         INLINE ~Env()
+         {
+            mPool->stop();
+            mServer.reset();
+            mLogger.reset();
+         }
+      };
+
+      /// <summary>
+      /// Spins until cond is true or about two seconds passed.
+      /// </summary>
+      template<typename F>
+      INLINE static bool waitFor(F cond)
+      {
+         for (size_t i = 0; i < 2000; i++)
+         {
+            if (cond())
+               return true;
+            ::std::this_thread::sleep_for(milliseconds(1));
+         }
+         return cond();
+      }
+
+      /// <summary>
+      /// Connects a client to the loopback port.
+      /// </summary>
+      INLINE static bool connect(TcpSocket& s)
+      {
+         return s.connect("127.0.0.1", ::std::to_string(PORT).c_str()) == TcpSocket::ConnectReturn::OK;
+      }
+
+      /// <summary>
+      /// Sends all bytes on a non-blocking socket.
+      /// </summary>
+      INLINE static bool sendAll(TcpSocket& s, const char* data, size_t len)
+      {
+         const TimePointHR END = ClockHR::now() + seconds(2);
+         while (len && ClockHR::now() < END)
+         {
+            const int rc = s.send((char*)data, (int)len);
+            if (rc > 0)
+            {
+               data += rc;
+               len  -= (size_t)rc;
+            }
+            else if (rc < 0 && CppCore::Socket::Op::isLastErrorBlock())
+               s.poll(POLLOUT, 16);
+            else
+               return false;
+         }
+         return len == 0;
+      }
+
+      /// <summary>
+      /// Receives exactly len bytes on a non-blocking socket.
+      /// </summary>
+      INLINE static bool recvAll(TcpSocket& s, char* data, size_t len)
+      {
+         const TimePointHR END = ClockHR::now() + seconds(2);
+         while (len && ClockHR::now() < END)
+         {
+            const int rc = s.recv(data, (int)len);
+            if (rc > 0)
+            {
+               data += rc;
+               len  -= (size_t)rc;
+            }
+            else if (rc < 0 && CppCore::Socket::Op::isLastErrorBlock())
+               s.poll(POLLIN, 16);
+            else
+               return false;
+         }
+         return len == 0;
+      }
+
+      /// <summary>
+      /// Sends a string and expects it back.
+      /// </summary>
+      INLINE static bool echo(TcpSocket& s, const string& msg)
+      {
+         string in(msg.length(), 0);
+         return sendAll(s, msg.c_str(), msg.length()) &&
+            recvAll(s, &in[0], in.length()) && in == msg;
+      }
+
+      /// <summary>
+      /// True once the server closed the connection of a client.
+      /// </summary>
+      INLINE static bool waitClosed(TcpSocket& s)
+      {
+         return waitFor([&s]() {
+            char c;
+            const int rc = s.recv(&c, 1);
+            return rc == 0 || (rc < 0 && !CppCore::Socket::Op::isLastErrorBlock());
+         });
+      }
+
+      /// <summary>
+      /// Accept, echo, client disconnect, reconnect into the same
+      /// session slot and disconnect of a silent client by timeout.
+      /// </summary>
+      INLINE static bool echo()
+      {
+         CppCore::Socket::Op::initSockets();
+         const bool ok = echoloopback();
+         CppCore::Socket::Op::shutdownSockets();
+         return ok;
+      }
+
+      INLINE static bool echoloopback()
+      {
+         constexpr size_t TRIES = 32;
+         const DurationHR TIMEOUT = milliseconds(500);
+         Env<Base> env(TIMEOUT);
+         Echo& cb = env.mEcho;
+         TcpSocket a, b;
+
+         // accept and echo
+         if (!connect(a) || !echo(a, "hello") || !echo(a, string(20000, 'x')) ||
+             !waitFor([&]() { return cb.mAccepted.load() == 1U; }))
+            return false;
+         const uint32_t ID = cb.mLastId.load();
+
+         // client disconnects
+         a.close();
+         if (!waitFor([&]() { return cb.mDisconnected.load() == 1U; }))
+            return false;
+
+         // reconnect until it's the same slot again (other reactors have other slots)
+         size_t i = 0;
+         for (; i < TRIES; i++)
+         {
+            if (!connect(b) || !echo(b, "again " + ::std::to_string(i)) ||
+                !waitFor([&]() { return cb.mAccepted.load() == i + 2U; }))
+               return false;
+            if (cb.mLastId.load() == ID)
+               break;
+            b.close();
+            if (!waitFor([&]() { return cb.mDisconnected.load() == i + 2U; }))
+               return false;
+         }
+         if (i == TRIES || !echo(b, "same slot"))
+            return false;
+
+         // silent client gets disconnected, but not before the timeout
+         const TimePointHR START = ClockHR::now();
+         return waitClosed(b) && ClockHR::now() - START >= TIMEOUT &&
+            waitFor([&]() { return cb.mDisconnected.load() == cb.mAccepted.load(); });
+      }
+
+      /// <summary>
+      /// Clients get spread over all reactors by SO_REUSEPORT.
+      /// Each session is served and freed by the reactor owning it.
+      /// </summary>
+      INLINE static bool reactors()
+      {
+         CppCore::Socket::Op::initSockets();
+         const bool ok = reactorsloopback();
+         CppCore::Socket::Op::shutdownSockets();
+         return ok;
+      }
+
+      INLINE static bool reactorsloopback()
+      {
+         constexpr size_t CLIENTS = 32;
+         constexpr size_t REACTORS = CPPCORE_NETSERVER_REACTORS;
+         constexpr size_t PERREACTOR = Sharded::SESSIONSPERREACTOR;
+         static_assert(CLIENTS <= PERREACTOR, "each reactor must be able to take all clients");
+         Env<Sharded> env(seconds(10));
+         Echo& cb = env.mEcho;
+         Sharded& server = *env.mServer;
+         TcpSocket clients[CLIENTS];
+
+         // all reactors listen on the shared port with their own session pool
+         if (!server.isListening())
+            return false;
+         for (size_t r = 0; r < REACTORS; r++)
+            if ((REACTORS > 1 && !server.isReusePort(r)) ||
+                server.getFree(r) != PERREACTOR || server.getFreeCapacity(r) != PERREACTOR)
+               return false;
+
+         // connect and echo on all clients
+         for (size_t i = 0; i < CLIENTS; i++)
+            if (!connect(clients[i]) || !echo(clients[i], "client " + ::std::to_string(i)))
+               return false;
+         if (!waitFor([&]() { return cb.mAccepted.load() == CLIENTS; }))
+            return false;
+
+         // sessions are owned by their reactor, free ones match
+         size_t used[REACTORS] = { };
+         for (size_t id = 0; id < CPPCORE_NETSERVER_MAXCLIENTS; id++)
+         {
+            if (!cb.mActive[id].load())
+               continue;
+            Session& s = server.getSession(id);
+            const size_t r = server.getReactorIndex(s);
+            if (r != id / PERREACTOR || !server.isOwnedBy(r, s))
+               return false;
+            used[r]++;
+         }
+         for (size_t r = 0; r < REACTORS; r++)
+            if (used[r] == 0 || server.getFree(r) != PERREACTOR - used[r])
+               return false;
+
+         // sessions go back to the reactor owning them
+         for (size_t i = 0; i < CLIENTS; i++)
+            clients[i].close();
+         if (!waitFor([&]() { return cb.mDisconnected.load() == CLIENTS; }))
+            return false;
+         for (size_t r = 0; r < REACTORS; r++)
+            if (!waitFor([&]() { return server.getFree(r) == PERREACTOR; }))
+               return false;
+         return true;
+      }
+
+      /// <summary>
+      /// A second server can't listen on a port without SO_REUSEPORT
+      /// and must not listen on any of its reactors then.
+      /// </summary>
+      INLINE static bool listenfail()
+      {
+         CppCore::Socket::Op::initSockets();
+         bool ok;
+         {
+            TcpSocket blocker;
+            ok = blocker.listen(PORT) == TcpSocket::ListenReturn::OK;
+            if (ok)
+            {
+               Env<Sharded> env(seconds(10));
+               ok = !env.mServer->isListening();
+               for (size_t r = 0; ok && r < CPPCORE_NETSERVER_REACTORS; r++)
+                  ok = !env.mServer->isListening(r);
+            }
+         }
+         CppCore::Socket::Op::shutdownSockets();
+         return ok;
+      }
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Network
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(TcpServer)
+   {
+   public:
+      TEST_METHOD(ECHO)       { Assert::AreEqual(true, CppCore::Test::Network::TcpServer::echo()); }
+      TEST_METHOD(REACTORS)   { Assert::AreEqual(true, CppCore::Test::Network::TcpServer::reactors()); }
+      TEST_METHOD(LISTENFAIL) { Assert::AreEqual(true, CppCore::Test::Network::TcpServer::listenfail()); }
+   };
+}}}}
+#endif
+#endif
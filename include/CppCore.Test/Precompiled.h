@@ -22,8 +22,15 @@
 #include <CppCore.Test/Containers/Array.h>
 #include <CppCore.Test/Containers/Queue.h>
 #include <CppCore.Test/Containers/HashTable.h>
+#include <CppCore.Test/Containers/Cache.h>
+#include <CppCore.Test/Containers/Pool.h>
 #include <CppCore.Test/Uuid.h>
 #include <CppCore.Test/Network/Socket.h>
+#include <CppCore.Test/Network/TcpLink.h>
+#include <CppCore.Test/Network/TcpServer.h>
+#include <CppCore.Test/Threading/Runnable.h>
+#include <CppCore.Test/Threading/Schedule.h>
+#include <CppCore.Test/Logger.h>
 #include <CppCore.Test/Memory.h>
 #include <CppCore.Test/String.h>
 #include <CppCore.Test/Buffer.h>
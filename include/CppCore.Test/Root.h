@@ -1,11 +1,18 @@
 #pragma once
 
+// Run the server tests with several reactors sharing the port (SO_REUSEPORT)
+#if !defined(CPPCORE_NETSERVER_REACTORS) && !defined(_WIN32)
+#define CPPCORE_NETSERVER_REACTORS 2
+#endif
+
 // CppCore Headers
 #include <CppCore/Version.h>
 #include <CppCore/Containers/Array.h>
 #include <CppCore/Containers/Queue.h>
 #include <CppCore/Containers/LinkedList.h>
 #include <CppCore/Containers/MinHeap.h>
+#include <CppCore/Containers/Cache.h>
+#include <CppCore/Containers/Pool.h>
 #include <CppCore/Encoding.h>
 #include <CppCore/BitOps.h>
 #include <CppCore/CPUID.h>
@@ -29,6 +36,9 @@
 #include <CppCore/Random.h>
 #include <CppCore/System.h>
 #include <CppCore/Network/Socket.h>
+#include <CppCore/Network/TcpServer.h>
+#include <CppCore/Threading/Thread.h>
+#include <CppCore/Logger.h>
 #include <CppCore/Example/Model.h>
 
 // Visual Studio Test Framework
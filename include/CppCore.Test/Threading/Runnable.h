@@ -0,0 +1,254 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+namespace CppCore { namespace Test { namespace Threading
+{
+   /// <summary>
+   /// Tests for Runnable.h in CppCore::Threading
+   /// </summary>
+   class Runnable
+   {
+   public:
+      /// <summary>
+      /// Runnable with public setExecutionTime()
+      /// </summary>
+      class Timer : public CppCore::Runnable
+      {
+      public:
+         using CppCore::Runnable::setExecutionTime;
+      };
+
+      /// <summary>
+      /// Two levels with 1ms ticks, everything 4096ms or more ahead overflows.
+      /// </summary>
+      typedef CppCore::Runnable::TimerWheel<2, 1000> TimerWheel;
+
+      /// <summary>
+      /// Offsets in ms from now. Covers past, level 0, level 1 and overflow
+      /// with some timers sharing a slot.
+      /// </summary>
+      static constexpr int64_t OFFSETS[] = {
+         -10000, 0, 1, 5, 5, 63, 64, 65, 100, 4000, 4095, 4096, 4097, 10000, 10000, 300000 };
+
+      static constexpr size_t NUMOFFSETS = sizeof(OFFSETS) / sizeof(OFFSETS[0]);
+
+      /// <summary>
+      /// Pops all due timers at now in order. Fails if one is popped before
+      /// its time, out of order or more than a tick late.
+      /// </summary>
+      INLINE static bool popAll(TimerWheel& wheel, const TimePointHR& now, TimePointHR& last, size_t& n)
+      {
+         CppCore::Runnable* r;
+         while (wheel.popDue(r, now))
+         {
+            const TimePointHR& t = r->getExecutionTime();
+            if (t > now || t < last || now - t >= milliseconds(1))
+               return false;
+            last = t;
+            n++;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// Pushes timers on all levels and drains the wheel only at the times
+      /// returned by next(), which must never be behind a pending timer.
+      /// </summary>
+      INLINE static bool timerwheelnext()
+      {
+         auto wheel = ::std::make_unique<TimerWheel>();
+         const TimePointHR NOW = ClockHR::now();
+         Timer timers[NUMOFFSETS];
+         TimePointHR t;
+         CppCore::Runnable* r;
+
+         if (wheel->next(t) || wheel->popDue(r, NOW))
+            return false;
+
+         for (size_t i = 0; i < NUMOFFSETS; i++)
+         {
+            timers[i].setExecutionTime(NOW + milliseconds(OFFSETS[i]));
+            if (!wheel->push(&timers[i]) || wheel->push(&timers[i]))
+               return false;
+         }
+         if (wheel->length() != NUMOFFSETS)
+            return false;
+
+         // the past one is due right away
+         if (!wheel->popDue(r, NOW) || r != &timers[0])
+            return false;
+
+         TimePointHR last(NOW);
+         size_t n = 1;
+
+         // next() may return the start of a higher level slot or the next
+         // overflow block first, so allow some calls without a due timer
+         for (size_t i = 0; i < 1000U && wheel->next(t); i++)
+            if (!popAll(*wheel, t, last, n))
+               return false;
+
+         return n == NUMOFFSETS && wheel->length() == 0 && !wheel->next(t);
+      }
+
+      /// <summary>
+      /// Advances the wheel in large steps, so slots on all levels and the
+      /// overflow list get cascaded in one popDue() call.
+      /// </summary>
+      INLINE static bool timerwheelcascade()
+      {
+         auto wheel = ::std::make_unique<TimerWheel>();
+         const TimePointHR NOW = ClockHR::now();
+         Timer timers[NUMOFFSETS];
+
+         for (size_t i = 0; i < NUMOFFSETS; i++)
+         {
+            timers[i].setExecutionTime(NOW + milliseconds(OFFSETS[i]));
+            if (!wheel->push(&timers[i]))
+               return false;
+         }
+
+         // expected amount of timers due at each step, a timer is due once
+         // the end of its tick passed, so steps keep a tick off the offsets
+         const int64_t STEPS[]  = { 2, 80, 4094, 4200, 20000, 1000000 };
+         const size_t  COUNTS[] = { 3, 8,  10,   13,   15,    16 };
+
+         TimePointHR last(DurationHR::zero());
+         size_t n = 0;
+         for (size_t i = 0; i < sizeof(STEPS) / sizeof(STEPS[0]); i++)
+         {
+            const TimePointHR STEP = NOW + milliseconds(STEPS[i]);
+            CppCore::Runnable* r;
+            while (wheel->popDue(r, STEP))
+            {
+               if (r->getExecutionTime() > STEP || r->getExecutionTime() < last)
+                  return false;
+               last = r->getExecutionTime();
+               n++;
+            }
+            if (n != COUNTS[i] || wheel->length() != NUMOFFSETS - n)
+               return false;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// Removes timers from the head, middle and tail of a slot, from a
+      /// higher level and from the overflow list and reschedules some.
+      /// </summary>
+      INLINE static bool timerwheelremove()
+      {
+         auto wheel = ::std::make_unique<TimerWheel>();
+         const TimePointHR NOW = ClockHR::now();
+         Timer timers[8];
+
+         // 0-3 share a slot, 4 on level 1, 5 overflows, 6-7 stay
+         const int64_t OFFS[] = { 10, 10, 10, 10, 200, 5000, 20, 300 };
+         for (size_t i = 0; i < 8; i++)
+         {
+            timers[i].setExecutionTime(NOW + milliseconds(OFFS[i]));
+            if (!wheel->push(&timers[i]))
+               return false;
+         }
+
+         // slot is 3,2,1,0 from head to tail
+         if (!wheel->remove(&timers[2]) || wheel->remove(&timers[2]) ||
+             !wheel->remove(&timers[3]) || !wheel->remove(&timers[0]) ||
+             !wheel->remove(&timers[4]) || !wheel->remove(&timers[5]) ||
+             wheel->length() != 3U)
+            return false;
+
+         // reschedule 2 later and 7 earlier
+         timers[2].setExecutionTime(NOW + milliseconds(5000));
+         if (!wheel->remove(&timers[7]))
+            return false;
+         timers[7].setExecutionTime(NOW + milliseconds(15));
+         if (!wheel->push(&timers[2]) || !wheel->push(&timers[7]) || wheel->length() != 4U)
+            return false;
+
+         CppCore::Runnable* popped[4];
+         size_t n = 0;
+         CppCore::Runnable* r;
+         while (wheel->popDue(r, NOW + milliseconds(100000)))
+         {
+            if (n == 4U) return false;
+            popped[n++] = r;
+         }
+         return n == 4U && wheel->length() == 0 &&
+            popped[0] == &timers[1] && popped[1] == &timers[7] &&
+            popped[2] == &timers[6] && popped[3] == &timers[2];
+      }
+
+      /// <summary>
+      /// Runnable::MinHeap push, remove, popDue and next
+      /// </summary>
+      INLINE static bool minheap()
+      {
+         CppCore::Runnable::MinHeap<8> heap;
+         const TimePointHR NOW = ClockHR::now();
+         Timer timers[8];
+         TimePointHR t;
+         CppCore::Runnable* r;
+
+         if (heap.next(t) || heap.popDue(r, NOW))
+            return false;
+
+         const int64_t OFFS[] = { 50, -5, 30, 10, 40, 20, 0, 60 };
+         for (size_t i = 0; i < 8; i++)
+         {
+            timers[i].setExecutionTime(NOW + milliseconds(OFFS[i]));
+            if (!heap.push(&timers[i]))
+               return false;
+         }
+
+         // full
+         Timer extra;
+         if (heap.push(&extra))
+            return false;
+
+         // earliest is the past one
+         if (!heap.next(t) || t != timers[1].getExecutionTime())
+            return false;
+
+         // remove it and one in the middle
+         if (!heap.remove(&timers[1]) || heap.remove(&timers[1]) || !heap.remove(&timers[5]))
+            return false;
+         if (!heap.next(t) || t != NOW)
+            return false;
+
+         // only the one at now is due now
+         if (!heap.popDue(r, NOW) || r != &timers[6] || heap.popDue(r, NOW))
+            return false;
+
+         // rest in order
+         const size_t ORDER[] = { 3, 2, 4, 0, 7 };
+         for (size_t i = 0; i < 5; i++)
+         {
+            if (!heap.next(t) || t != timers[ORDER[i]].getExecutionTime())
+               return false;
+            if (heap.popDue(r, t - milliseconds(1)))
+               return false;
+            if (!heap.popDue(r, t) || r != &timers[ORDER[i]])
+               return false;
+         }
+         return !heap.next(t) && heap.length() == 0;
+      }
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Threading
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(Runnable)
+   {
+   public:
+      TEST_METHOD(TIMERWHEELNEXT)    { Assert::AreEqual(true, CppCore::Test::Threading::Runnable::timerwheelnext()); }
+      TEST_METHOD(TIMERWHEELCASCADE) { Assert::AreEqual(true, CppCore::Test::Threading::Runnable::timerwheelcascade()); }
+      TEST_METHOD(TIMERWHEELREMOVE)  { Assert::AreEqual(true, CppCore::Test::Threading::Runnable::timerwheelremove()); }
+      TEST_METHOD(MINHEAP)           { Assert::AreEqual(true, CppCore::Test::Threading::Runnable::minheap()); }
+   };
+}}}}
+#endif
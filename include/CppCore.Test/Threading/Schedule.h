@@ -0,0 +1,456 @@
+#pragma once
+
+#include <CppCore.Test/Root.h>
+
+namespace CppCore { namespace Test { namespace Threading
+{
+   /// <summary>
+   /// Tests for Schedule.h in CppCore::Threading
+   /// </summary>
+   class Schedule
+   {
+   public:
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// Schedule with timers in a MinHeap (default)
+      /// </summary>
+      typedef CppCore::ScheduleT<CppCore::Runnable::MinHeap<CPPCORE_DEFAULT_TIMERCOUNT>> Heap;
+
+      /// <summary>
+      /// Schedule with timers in a TimerWheel (CPPCORE_SCHEDULE_TIMERWHEEL)
+      /// </summary>
+      typedef CppCore::ScheduleT<CppCore::Runnable::TimerWheel<>> Wheel;
+
+      /// <summary>
+      /// Minimal looper for Schedule::execute(TLOOPER&)
+      /// </summary>
+      class Looper
+      {
+      public:
+         INLINE void setExecuting(bool) { }
+      };
+
+      /// <summary>
+      /// Spins until cond is true or about a second passed.
+      /// </summary>
+      template<typename F>
+      INLINE static bool waitFor(F cond)
+      {
+         for (size_t i = 0; i < 1000; i++)
+         {
+            if (cond())
+               return true;
+            ::std::this_thread::sleep_for(milliseconds(1));
+         }
+         return cond();
+      }
+
+      /// <summary>
+      /// Runnables pushed to the local run queue of a worker that never
+      /// executes must be stolen and run by the other workers.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool steal()
+      {
+         constexpr size_t N = 128;
+         constexpr size_t THREADS = 3;
+
+         auto schedule = ::std::make_unique<TSCHEDULE>();
+         ::std::unique_ptr<CppCore::Runnable[]> runnables(new CppCore::Runnable[N]);
+         atomic<size_t> counts[N];
+         atomic<size_t> done(0);
+         atomic<bool>   stop(false);
+         atomic<bool>   pushed(false);
+         atomic<size_t> errors(0);
+         ::std::thread owner;
+         ::std::thread thieves[THREADS];
+
+         for (size_t i = 0; i < N; i++)
+         {
+            counts[i] = 0;
+            runnables[i].setFunction([&counts, &done, i]() {
+               counts[i]++;
+               done++;
+            });
+         }
+
+         // owner fills its local queue and waits without executing
+         owner = ::std::thread([&]() {
+            if (!schedule->attach()) errors++;
+            for (size_t i = 0; i < N; i++)
+               if (!schedule->schedule(runnables[i])) errors++;
+            pushed = true;
+            while (!stop) ::std::this_thread::yield();
+            schedule->detach();
+         });
+
+         // others only get work by stealing it
+         for (size_t t = 0; t < THREADS; t++)
+            thieves[t] = ::std::thread([&]() {
+               schedule->attach();
+               while (!pushed) ::std::this_thread::yield();
+               while (!stop)
+                  if (!schedule->execute())
+                     ::std::this_thread::yield();
+               schedule->detach();
+            });
+
+         const bool ok = waitFor([&]() { return done.load() == N; });
+         stop = true;
+         owner.join();
+         for (size_t t = 0; t < THREADS; t++)
+            thieves[t].join();
+
+         if (!ok || errors.load())
+            return false;
+         for (size_t i = 0; i < N; i++)
+            if (counts[i].load() != 1U || !runnables[i].isIdle())
+               return false;
+         return true;
+      }
+
+      /// <summary>
+      /// Runnables left in the local run queue of a detaching worker must
+      /// still run exactly once. If they don't fit into the shared queue
+      /// anymore the detaching thread runs them itself.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool detach()
+      {
+         constexpr size_t M = 32;
+         constexpr size_t S = CPPCORE_DEFAULT_INSTANTTIMERCOUNT;
+
+         auto schedule = ::std::make_unique<TSCHEDULE>();
+         ::std::unique_ptr<CppCore::Runnable[]> runnables(new CppCore::Runnable[S + M]);
+         ::std::unique_ptr<atomic<size_t>[]> counts(new atomic<size_t>[S + M]);
+         ::std::thread::id detacher;
+         atomic<size_t> onDetacher(0);
+         atomic<size_t> errors(0);
+
+         for (size_t i = 0; i < S + M; i++)
+         {
+            counts[i] = 0;
+            runnables[i].setFunction([&counts, &detacher, &onDetacher, i]() {
+               counts[i]++;
+               if (::std::this_thread::get_id() == detacher)
+                  onDetacher++;
+            });
+         }
+
+         // a) moved to the shared queue and run by this unattached thread
+         ::std::thread t1([&]() {
+            if (!schedule->attach()) errors++;
+            for (size_t i = 0; i < M; i++)
+               if (!schedule->schedule(runnables[i])) errors++;
+            schedule->detach();
+         });
+         t1.join();
+         for (size_t i = 0; i < M; i++)
+            if (!schedule->execute())
+               return false;
+         if (schedule->execute() || errors.load())
+            return false;
+         for (size_t i = 0; i < M; i++)
+            if (counts[i].load() != 1U)
+               return false;
+
+         // b) shared queue is full, the detaching thread must run them
+         for (size_t i = M; i < S + M; i++)
+            counts[i] = 0;
+         for (size_t i = M; i < S; i++)
+            if (!schedule->schedule(runnables[i]))
+               return false;
+         ::std::thread t2([&]() {
+            detacher = ::std::this_thread::get_id();
+            if (!schedule->attach()) errors++;
+            for (size_t i = S; i < S + M; i++)
+               if (!schedule->schedule(runnables[i])) errors++;
+
+            // fill up remaining shared slots from another thread
+            ::std::thread t3([&]() {
+               for (size_t i = 0; i < M; i++)
+                  if (!schedule->schedule(runnables[i])) errors++;
+            });
+            t3.join();
+            schedule->detach();
+         });
+         t2.join();
+         if (errors.load() || onDetacher.load() != M)
+            return false;
+
+         // drain the shared queue
+         while (schedule->execute());
+         for (size_t i = 0; i < M; i++)
+            if (counts[i].load() != 2U)
+               return false;
+         for (size_t i = M; i < S + M; i++)
+            if (counts[i].load() != 1U)
+               return false;
+         return true;
+      }
+
+      /// <summary>
+      /// Cancels instant runnables in the shared queue, in the local run queue
+      /// of a worker and after they were moved there by batching.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool cancel()
+      {
+         constexpr size_t N = 4;
+
+         auto schedule = ::std::make_unique<TSCHEDULE>();
+         CppCore::Runnable runnables[N];
+         atomic<size_t> runs(0);
+         atomic<size_t> errors(0);
+
+         for (size_t i = 0; i < N; i++)
+            runnables[i].setFunction([&runs]() { runs++; });
+
+         // a) shared queue
+         if (!schedule->schedule(runnables[0]) || !runnables[0].isScheduled())
+            return false;
+         if (!schedule->cancel(runnables[0]) || !runnables[0].isIdle())
+            return false;
+         if (schedule->cancel(runnables[0]) || schedule->execute())
+            return false;
+
+         // b) local run queue of a worker
+         ::std::thread t1([&]() {
+            if (!schedule->attach()) errors++;
+            if (!schedule->schedule(runnables[1])) errors++;
+            if (!schedule->cancel(runnables[1]))   errors++;
+            if (schedule->cancel(runnables[1]))    errors++;
+            if (schedule->execute())               errors++;
+            schedule->detach();
+         });
+         t1.join();
+         if (errors.load() || !runnables[1].isIdle())
+            return false;
+
+         // c) moved from the shared to a local queue by batching
+         for (size_t i = 0; i < N; i++)
+            if (!schedule->schedule(runnables[i]))
+               return false;
+         atomic<bool> taken(false);
+         atomic<bool> canceled(false);
+         ::std::thread t2([&]() {
+            if (!schedule->attach()) errors++;
+            if (!schedule->execute()) errors++;
+            taken = true;
+            while (!canceled) ::std::this_thread::yield();
+            if (schedule->execute()) errors++;
+            schedule->detach();
+         });
+         while (!taken) ::std::this_thread::yield();
+         size_t ncanceled = 0;
+         for (size_t i = 0; i < N; i++)
+            if (schedule->cancel(runnables[i]))
+               ncanceled++;
+         canceled = true;
+         t2.join();
+
+         if (errors.load() || runs.load() != 1U || ncanceled != N - 1U)
+            return false;
+         for (size_t i = 0; i < N; i++)
+            if (!runnables[i].isIdle())
+               return false;
+         return !schedule->execute();
+      }
+
+      /// <summary>
+      /// A push to a local run queue must wake a sleeping worker
+      /// long before its default sleep elapses.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool wake()
+      {
+         constexpr size_t ROUNDS = 50;
+
+         auto schedule = ::std::make_unique<TSCHEDULE>(seconds(10));
+         CppCore::Runnable runnable;
+         atomic<size_t> runs(0);
+         atomic<bool>   stop(false);
+         atomic<bool>   exited(false);
+         atomic<size_t> errors(0);
+
+         runnable.setFunction([&runs]() { runs++; });
+
+         // sleeper executes with the long default sleep
+         ::std::thread sleeper([&]() {
+            Looper looper;
+            schedule->attach();
+            while (!stop)
+               schedule->execute(looper);
+            schedule->detach();
+            exited = true;
+         });
+
+         // owner pushes locally and never executes, so only the sleeper can run it
+         ::std::thread owner([&]() {
+            if (!schedule->attach()) errors++;
+            for (size_t i = 0; i < ROUNDS; i++)
+            {
+               ::std::this_thread::sleep_for(microseconds(i * 37U % 500U));
+               if (!schedule->schedule(runnable)) errors++;
+               if (!waitFor([&]() { return runs.load() == i + 1U; })) { errors++; break; }
+               while (!runnable.isIdle()) ::std::this_thread::yield();
+            }
+            schedule->detach();
+         });
+
+         owner.join();
+         stop = true;
+         while (!exited)
+         {
+            schedule->wakeAll();
+            ::std::this_thread::yield();
+         }
+         sleeper.join();
+         return errors.load() == 0 && runs.load() == ROUNDS;
+      }
+
+      /// <summary>
+      /// Timers run once and not before their time, canceled ones never
+      /// and rescheduled ones only at their new time.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool timers()
+      {
+         constexpr size_t N = 16;
+
+         auto schedule = ::std::make_unique<TSCHEDULE>(milliseconds(5));
+         CppCore::Runnable runnables[N];
+         atomic<size_t> counts[N];
+         TimePointHR    ranAt[N];
+         TimePointHR    dueAt[N];
+         atomic<size_t> runs(0);
+         atomic<bool>   stop(false);
+
+         for (size_t i = 0; i < N; i++)
+         {
+            counts[i] = 0;
+            runnables[i].setFunction([&counts, &ranAt, &runs, i]() {
+               ranAt[i] = ClockHR::now();
+               counts[i]++;
+               runs++;
+            });
+         }
+
+         ::std::thread worker([&]() {
+            Looper looper;
+            schedule->attach();
+            while (!stop)
+               schedule->execute(looper);
+            schedule->detach();
+         });
+
+         // every 4th is canceled, every 4th+1 is rescheduled to later
+         const TimePointHR NOW = ClockHR::now();
+         for (size_t i = 0; i < N; i++)
+         {
+            dueAt[i] = NOW + milliseconds(20 + (i * 7U) % 40U);
+            if (!schedule->schedule(runnables[i], dueAt[i]))
+               return false;
+         }
+         for (size_t i = 0; i < N; i += 4)
+            if (!schedule->cancel(runnables[i]) || schedule->cancel(runnables[i]))
+               return false;
+         for (size_t i = 1; i < N; i += 4)
+         {
+            if (!schedule->cancel(runnables[i]))
+               return false;
+            dueAt[i] += milliseconds(30);
+            if (!schedule->schedule(runnables[i], dueAt[i]))
+               return false;
+         }
+
+         const bool ok = waitFor([&]() { return runs.load() == N - N / 4U; });
+         ::std::this_thread::sleep_for(milliseconds(20));
+         stop = true;
+         schedule->wakeAll();
+         worker.join();
+
+         if (!ok || runs.load() != N - N / 4U)
+            return false;
+         for (size_t i = 0; i < N; i++)
+         {
+            if (counts[i].load() != (i % 4U == 0U ? 0U : 1U) || !runnables[i].isIdle())
+               return false;
+            if (counts[i].load() && ranAt[i] < dueAt[i] - microseconds(CPPCORE_RUNNABLE_EXECUTE_TOLERANCE_US))
+               return false;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// A runnable rescheduling itself on the local run queue of the only
+      /// worker must not starve shared instant runnables and timers.
+      /// </summary>
+      template<typename TSCHEDULE>
+      INLINE static bool fair()
+      {
+         auto schedule = ::std::make_unique<TSCHEDULE>(milliseconds(5));
+         CppCore::Runnable spin, instant, timer;
+         atomic<size_t> spins(0);
+         atomic<size_t> runs(0);
+         atomic<bool>   stop(false);
+
+         spin.setFunction([&]() {
+            spins++;
+            if (!stop) schedule->schedule(spin);
+         });
+         instant.setFunction([&runs]() { runs++; });
+         timer.setFunction([&runs]() { runs++; });
+
+         ::std::thread worker([&]() {
+            Looper looper;
+            schedule->attach();
+            schedule->schedule(spin);
+            while (!stop)
+               schedule->execute(looper);
+            schedule->detach();
+         });
+
+         // from this unattached thread both go to the shared queues
+         const bool spinning = waitFor([&]() { return spins.load() > 1000U; });
+         if (spinning)
+         {
+            schedule->schedule(instant);
+            schedule->schedule(timer, ClockHR::now() + milliseconds(10));
+         }
+         const bool ok = spinning && waitFor([&]() { return runs.load() == 2U; });
+         stop = true;
+         schedule->wakeAll();
+         worker.join();
+         return ok;
+      }
+   #endif
+   };
+}}}
+
+#if defined(CPPCORE_COMPILER_MSVC)
+namespace CppCore { namespace Test { namespace VS { namespace Threading
+{
+   /// <summary>
+   /// Visual Studio Test Class
+   /// </summary>
+   TEST_CLASS(Schedule)
+   {
+   public:
+   #ifndef CPPCORE_NO_THREADING
+      TEST_METHOD(STEALHEAP)   { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::steal<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(DETACHHEAP)  { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::detach<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(CANCELHEAP)  { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::cancel<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(WAKEHEAP)    { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::wake<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(TIMERSHEAP)  { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::timers<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(FAIRHEAP)    { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::fair<CppCore::Test::Threading::Schedule::Heap>()); }
+      TEST_METHOD(STEALWHEEL)  { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::steal<CppCore::Test::Threading::Schedule::Wheel>()); }
+      TEST_METHOD(DETACHWHEEL) { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::detach<CppCore::Test::Threading::Schedule::Wheel>()); }
+      TEST_METHOD(CANCELWHEEL) { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::cancel<CppCore::Test::Threading::Schedule::Wheel>()); }
+      TEST_METHOD(WAKEWHEEL)   { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::wake<CppCore::Test::Threading::Schedule::Wheel>()); }
+      TEST_METHOD(TIMERSWHEEL) { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::timers<CppCore::Test::Threading::Schedule::Wheel>()); }
+      TEST_METHOD(FAIRWHEEL)   { Assert::AreEqual(true, CppCore::Test::Threading::Schedule::fair<CppCore::Test::Threading::Schedule::Wheel>()); }
+   #endif
+   };
+}}}}
+#endif
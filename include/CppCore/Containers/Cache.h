@@ -12,6 +12,13 @@ namespace CppCore
    class Cache
    {
    public:
+      /// <summary>
+      /// Eviction Policies.
+      /// LRU keeps entries ordered by last use, each hit moves the entry to the front.
+      /// CLOCK only sets a flag on hits and gives flagged entries a second chance on prune.
+      /// </summary>
+      enum class Policy { LRU, CLOCK };
+
       /// <summary>
       /// Entry used in Cache
       /// </summary>
@@ -23,6 +30,9 @@ namespace CppCore
          uint32_t    Refs;
          TimePointHR Tick;
          size_t      Size;
+         Entry<T>*   Prev;
+         Entry<T>*   Next;
+         uint8_t     Used;
 
          /// <summary>
          /// Entry Comparers
@@ -93,14 +103,20 @@ namespace CppCore
       };
 
       /// <summary>
-      /// Cache for Single Thread
+      /// Cache for Single Thread.
+      /// Entries are kept in an intrusive ring updated on insert, find and remove,
+      /// so prune() only visits the eviction candidates instead of the whole table.
+      /// Hits store a coarse tick refreshed by insert(), prune() and tick().
+      /// Hits since the last refresh count as age zero in prune(), older ones are
+      /// aged from the refresh before them, so ages are exact to one refresh interval.
       /// </summary>
       template<
          typename T, 
          typename KEY,
          size_t   SIZE,
          typename COMPARER,
-         size_t   SIZEPRUNE>
+         size_t   SIZEPRUNE,
+         Policy   POLICY = Policy::LRU>
       class ST
       {
       public:
@@ -108,28 +124,93 @@ namespace CppCore
          using ArrayEntry = Array::Fix::ST<Entry<T>*, SIZEPRUNE>;
 
       protected:
-         HT         mHT;
-         ArrayEntry mPruneList;
-         size_t     mMemoryUsage;
-         size_t     mMemoryLimit;
+         /// <summary>
+         /// Used flag of a CLOCK entry while prune() adds it to the prune list
+         /// </summary>
+         static constexpr uint8_t QUEUED = 2U;
+
+         HT          mHT;
+         ArrayEntry  mPruneList;
+         size_t      mMemoryUsage;
+         size_t      mMemoryLimit;
+         Entry<T>*   mRing;
+         TimePointHR mTick;
+
+         /// <summary>
+         /// Adds an entry to the ring. Becomes the most recent one for LRU
+         /// and the last one visited by the CLOCK hand.
+         /// </summary>
+         INLINE void link(Entry<T>* e)
+         {
+            if (mRing)
+            {
+               e->Next = mRing;
+               e->Prev = mRing->Prev;
+               mRing->Prev->Next = e;
+               mRing->Prev = e;
+               if constexpr (POLICY == Policy::LRU)
+                  mRing = e;
+            }
+            else
+            {
+               e->Next = e;
+               e->Prev = e;
+               mRing = e;
+            }
+         }
+
+         /// <summary>
+         /// Removes an entry from the ring.
+         /// </summary>
+         INLINE void unlink(Entry<T>* e)
+         {
+            if (e->Next == e)
+               mRing = nullptr;
+            else
+            {
+               e->Prev->Next = e->Next;
+               e->Next->Prev = e->Prev;
+               if (mRing == e)
+                  mRing = e->Next;
+            }
+         }
+
+         /// <summary>
+         /// Age of an entry at the current tick. Hits since the refresh
+         /// at last might have happened just now, so they count as zero.
+         /// </summary>
+         INLINE DurationHR age(const Entry<T>* o, const TimePointHR& last) const
+         {
+            return o->Tick == last ? DurationHR::zero() : mTick - o->Tick;
+         }
 
       public:
-         INLINE size_t        length()         const { return mHT.length(); }
-         INLINE size_t        getMemoryUsage() const { return mMemoryUsage; }
-         INLINE size_t        getMemoryLimit() const { return mMemoryLimit; }
-         INLINE HT&           getHT()                { return mHT; }
-         INLINE ArrayEntry&   getPruneList()         { return mPruneList; }
+         INLINE size_t             length()         const { return mHT.length(); }
+         INLINE size_t             getMemoryUsage() const { return mMemoryUsage; }
+         INLINE size_t             getMemoryLimit() const { return mMemoryLimit; }
+         INLINE const TimePointHR& getTick()        const { return mTick; }
+         INLINE HT&                getHT()                { return mHT; }
+         INLINE ArrayEntry&        getPruneList()         { return mPruneList; }
 
          INLINE void setMemoryLimit(size_t v) { mMemoryLimit = v; }
 
          /// <summary>
          /// Constructor
          /// </summary>
-         INLINE ST() : mMemoryUsage(0), mMemoryLimit(0)
+         INLINE ST() : mMemoryUsage(0), mMemoryLimit(0), mRing(nullptr), mTick(ClockHR::now())
          {
 
          }
 
+         /// <summary>
+         /// Refreshes the coarse tick stored on hits.
+         /// Call it more often than prune() for finer ages.
+         /// </summary>
+         INLINE void tick()
+         {
+            mTick = ClockHR::now();
+         }
+
          ////////////////////////////////////////////////////////////////////////////////////////////////
 
          /// <summary>
@@ -151,15 +232,27 @@ namespace CppCore
          ////////////////////////////////////////////////////////////////////////////////////////////////
 
          /// <summary>
-         ///
+         /// Looks up an entry and increments its references on success.
+         /// Marks it as recently used without reading the clock.
          /// </summary>
          INLINE Entry<T>* find(const KEY& key)
          {
             if (Entry<T>* o = mHT.find(key))
             {
-               o->Tick = ClockHR::now();
+               o->Tick = mTick;
                o->Refs++;
 
+               if constexpr (POLICY == Policy::LRU)
+               {
+                  if (o != mRing)
+                  {
+                     unlink(o);
+                     link(o);
+                  }
+               }
+               else
+                  o->Used = 1;
+
                return o;
             }
             else
@@ -174,12 +267,16 @@ namespace CppCore
          {
             if (entry)
             {
-               entry->Data.Tick = ClockHR::now();
+               tick();
+
+               entry->Data.Tick = mTick;
                entry->Data.Refs = 1;
                entry->Data.Size = size;
+               entry->Data.Used = 0;
 
                if (mHT.insert(key, entry))
                {
+                  link(&entry->Data);
                   mMemoryUsage += size;
                   return true;
                }
@@ -203,6 +300,7 @@ namespace CppCore
                // must have zero references to get removed
                if (o->Data.Refs == 0)
                {
+                  unlink(&o->Data);
                   mMemoryUsage -= o->Data.Size;
                   mHT.pushFreeEntry(o);
                   return true;
@@ -221,6 +319,8 @@ namespace CppCore
          /// Builds a prune list (see getPruneList) with cache entries that have no active
          /// references and match filters in parameters. Returns true if the list contains
          /// elements afterwards which can be removed by calling remove().
+         /// LRU walks from the least recently used entry and stops at the first one younger
+         /// than minage. CLOCK advances its hand and clears the used flags it passes.
          /// </summary>
          INLINE bool prune(
             const DurationHR& minage = seconds(60), 
@@ -229,37 +329,354 @@ namespace CppCore
             // true if exceeded soft limit
             const bool URGENT = mMemoryLimit > 0 && mMemoryUsage > mMemoryLimit;
 
-            // get current tick
-            auto now = ClockHR::now();
+            // refresh current tick, keep the one stored on recent hits
+            const TimePointHR LAST = mTick;
+            tick();
 
             // clear old prune list
             mPruneList.clear();
 
-            // loop over all cache entries
-            for (Entry<T>& o : mHT)
+            // nothing cached
+            if (!mRing)
+               return false;
+
+            if constexpr (POLICY == Policy::LRU)
+            {
+               // walk from least recently used one
+               Entry<T>* o = mRing->Prev;
+               for (size_t i = mHT.length(); i; i--, o = o->Prev)
+               {
+                  // ignore ones with references
+                  if (o->Refs > 0)
+                     continue;
+
+                  // all following ones are even more recently used
+                  if (!URGENT && age(o, LAST) < minage)
+                     break;
+
+                  // try add to prune list, stop if full
+                  if (!mPruneList.pushBack(o))
+                     break;
+
+                  // also stop if reached desired maximum
+                  if (mPruneList.length() >= maxnum)
+                     break;
+               }
+            }
+            else
             {
-               // ignore ones with references
-               if (o.Refs > 0)
-                  continue;
+               // at most two rounds, the first one might only clear used flags
+               Entry<T>* o = mRing;
+               for (size_t i = mHT.length() * 2U; i; i--)
+               {
+                  Entry<T>* n = o->Next;
 
-               // get time span since it was last used
-               const auto span = now - o.Tick;
+                  // already added in the first round
+                  if (o->Used == QUEUED) { }
 
-               // ignore too recently used ones
-               if (!URGENT && span < minage)
-                  continue;
+                  // second chance for used ones
+                  else if (o->Used)
+                     o->Used = 0;
 
-               // try add to prune list, stop if full
-               if (!mPruneList.pushBack(&o))
-                  break;
+                  // candidate if unreferenced and old enough
+                  else if (o->Refs == 0 && (URGENT || age(o, LAST) >= minage))
+                  {
+                     // stop if full, hand stays on this one
+                     if (!mPruneList.pushBack(o))
+                        break;
 
-               // also stop if reached desired maximum
-               if (mPruneList.length() >= maxnum)
-                  break;
+                     o->Used = QUEUED;
+
+                     // also stop if reached desired maximum
+                     if (mPruneList.length() >= maxnum)
+                     {
+                        o = n;
+                        break;
+                     }
+                  }
+                  o = n;
+               }
+
+               // hand continues after the last visited one
+               mRing = o;
+
+               // unmark them again
+               for (size_t i = 0; i < mPruneList.length(); i++)
+                  mPruneList[i]->Used = 0;
             }
 
             return mPruneList.length() > 0;
          }
       };
+
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// Cache for Multi Threaded Access.
+      /// Splits the key space over SHARDS single threaded caches, each with its own lock,
+      /// eviction state and relaxed atomic hit, miss and eviction counters.
+      /// SIZE and the memory limit are distributed evenly over the shards.
+      /// </summary>
+      template<
+         typename T, 
+         typename KEY,
+         size_t   SIZE,
+         typename COMPARER,
+         size_t   SIZEPRUNE,
+         size_t   SHARDS = 16,
+         Policy   POLICY = Policy::LRU,
+         typename HASHER = Murmur3>
+      class MT
+      {
+      private:
+         static_assert(popcnt64_generic(SHARDS) == 1U);
+         static_assert(SIZE % SHARDS == 0U);
+         static constexpr uint32_t SHIFT = 32U - popcnt64_generic(SHARDS - 1U);
+
+      public:
+         using Base = ST<T, KEY, SIZE / SHARDS, COMPARER, SIZEPRUNE, POLICY>;
+
+         /// <summary>
+         /// Counters summed over all shards
+         /// </summary>
+         struct Stats
+         {
+            uint64_t Hits;
+            uint64_t Misses;
+            uint64_t Evictions;
+         };
+
+      protected:
+         /// <summary>
+         /// Single threaded cache with lock and counters on its own cache line
+         /// </summary>
+         class CPPCORE_ALIGN64 Shard : public Base
+         {
+         public:
+            CPPCORE_MUTEX_TYPE mLock;
+            atomic<uint64_t>   mHits;
+            atomic<uint64_t>   mMisses;
+            atomic<uint64_t>   mEvictions;
+            INLINE Shard() : Base(), mHits(0), mMisses(0), mEvictions(0) { CPPCORE_MUTEX_INIT(mLock); }
+            INLINE ~Shard() { CPPCORE_MUTEX_DELETE(mLock); }
+         };
+
+         Shard mShards[SHARDS];
+
+         /// <summary>
+         /// Uses the highest bits of the key hash, the lowest ones select the bucket in the shard.
+         /// </summary>
+         INLINE Shard& shard(const KEY& key)
+         {
+            typename HASHER::Digest hash;
+            HASHER hasher;
+            hasher.hash(key, hash);
+            if constexpr (SHARDS == 1U)
+               return mShards[0];
+            else
+               return mShards[(uint32_t)hash >> SHIFT];
+         }
+
+      public:
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE MT() { }
+
+         /// <summary>
+         /// Number of shards
+         /// </summary>
+         INLINE size_t shards() const { return SHARDS; }
+
+         /// <summary>
+         /// Sum of cached entries over all shards.
+         /// </summary>
+         INLINE size_t length()
+         {
+            size_t n = 0;
+            for (Shard& s : mShards)
+            {
+               CPPCORE_MUTEX_LOCK(s.mLock);
+               n += s.length();
+               CPPCORE_MUTEX_UNLOCK(s.mLock);
+            }
+            return n;
+         }
+
+         /// <summary>
+         /// Sum of memory usage over all shards.
+         /// </summary>
+         INLINE size_t getMemoryUsage()
+         {
+            size_t n = 0;
+            for (Shard& s : mShards)
+            {
+               CPPCORE_MUTEX_LOCK(s.mLock);
+               n += s.getMemoryUsage();
+               CPPCORE_MUTEX_UNLOCK(s.mLock);
+            }
+            return n;
+         }
+
+         /// <summary>
+         /// Sets the total memory limit, each shard gets an equal part.
+         /// </summary>
+         INLINE void setMemoryLimit(size_t v)
+         {
+            for (Shard& s : mShards)
+            {
+               CPPCORE_MUTEX_LOCK(s.mLock);
+               s.setMemoryLimit(v / SHARDS);
+               CPPCORE_MUTEX_UNLOCK(s.mLock);
+            }
+         }
+
+         /// <summary>
+         /// Reads the counters without locking.
+         /// </summary>
+         INLINE void getStats(Stats& stats) const
+         {
+            stats.Hits = stats.Misses = stats.Evictions = 0;
+            for (const Shard& s : mShards)
+            {
+               stats.Hits      += s.mHits.load(::std::memory_order_relaxed);
+               stats.Misses    += s.mMisses.load(::std::memory_order_relaxed);
+               stats.Evictions += s.mEvictions.load(::std::memory_order_relaxed);
+            }
+         }
+
+         ////////////////////////////////////////////////////////////////////////////////////////////////
+
+         /// <summary>
+         /// Gets a free entry from the pool of the shard owning key.
+         /// Must be passed to insert() or pushFreeEntry() with the same key.
+         /// </summary>
+         INLINE HashTable::Entry<Entry<T>>* popFreeEntry(const KEY& key)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            HashTable::Entry<Entry<T>>* ret = s.popFreeEntry();
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            return ret;
+         }
+
+         /// <summary>
+         /// Pushes an unused entry back to the pool of the shard owning key.
+         /// </summary>
+         INLINE bool pushFreeEntry(const KEY& key, HashTable::Entry<Entry<T>>* entry)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            const bool ret = s.pushFreeEntry(entry);
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            return ret;
+         }
+
+         ////////////////////////////////////////////////////////////////////////////////////////////////
+
+         /// <summary>
+         /// Looks up an entry and increments its references on success.
+         /// The entry stays valid until it is handed to release().
+         /// </summary>
+         INLINE Entry<T>* find(const KEY& key)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            Entry<T>* ret = s.find(key);
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            if (ret) s.mHits.fetch_add(1U, ::std::memory_order_relaxed);
+            else     s.mMisses.fetch_add(1U, ::std::memory_order_relaxed);
+            return ret;
+         }
+
+         /// <summary>
+         /// Looks up an entry and copies its data without keeping a reference.
+         /// </summary>
+         INLINE bool find(const KEY& key, T& item)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            Entry<T>* e = s.find(key);
+            if (e)
+            {
+               item = e->Data;
+               e->Refs--;
+            }
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            if (e) s.mHits.fetch_add(1U, ::std::memory_order_relaxed);
+            else   s.mMisses.fetch_add(1U, ::std::memory_order_relaxed);
+            return e != nullptr;
+         }
+
+         /// <summary>
+         /// Drops a reference acquired by find() or insert().
+         /// </summary>
+         INLINE void release(const KEY& key, Entry<T>* entry)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            assert(entry->Refs > 0);
+            entry->Refs--;
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+         }
+
+         /// <summary>
+         /// Tries to insert an entry received from popFreeEntry() with the same key.
+         /// Sets the active references to 1, call release() once done with it.
+         /// </summary>
+         INLINE bool insert(const KEY& key, HashTable::Entry<Entry<T>>* entry, const size_t size = 0)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            const bool ret = s.insert(key, entry, size);
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            return ret;
+         }
+
+         /// <summary>
+         /// Tries to remove an entry. Returns false if it could not
+         /// be found or still has active references.
+         /// </summary>
+         INLINE bool remove(const KEY& key)
+         {
+            Shard& s = shard(key);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            const bool ret = s.remove(key);
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            return ret;
+         }
+
+         ////////////////////////////////////////////////////////////////////////////////////////////////
+
+         /// <summary>
+         /// Prunes and removes up to maxnum unreferenced entries per shard, see ST::prune().
+         /// The function keyof must return the KEY of cached data.
+         /// Returns the number of evicted entries.
+         /// </summary>
+         template<typename FUNC>
+         INLINE size_t evict(
+            const FUNC&       keyof,
+            const DurationHR& minage = seconds(60), 
+            const size_t      maxnum = 16)
+         {
+            size_t n = 0;
+            for (Shard& s : mShards)
+            {
+               size_t k = 0;
+               CPPCORE_MUTEX_LOCK(s.mLock);
+               if (s.prune(minage, maxnum))
+               {
+                  auto& list = s.getPruneList();
+                  for (size_t i = 0; i < list.length(); i++)
+                     if (s.remove(keyof(list[i]->Data)))
+                        k++;
+               }
+               CPPCORE_MUTEX_UNLOCK(s.mLock);
+               s.mEvictions.fetch_add(k, ::std::memory_order_relaxed);
+               n += k;
+            }
+            return n;
+         }
+      };
+   #endif
    };
 }
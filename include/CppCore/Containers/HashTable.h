@@ -377,9 +377,357 @@ namespace CppCore
          }
       };
 
+      /// <summary>
+      /// Amount of control bytes HashTable::Flat compares at once.
+      /// </summary>
+   #if defined(CPPCORE_CPUFEAT_AVX2)
+      static constexpr size_t GROUPSIZE = 32U;
+   #else
+      static constexpr size_t GROUPSIZE = 16U;
+   #endif
+
+      /// <summary>
+      /// Open Addressing HashTable for Single Threaded Access.
+      /// Same template parameters and find/insert/remove as ST but stores
+      /// items in a flat array of slots instead of pooled chained entries.
+      /// Each slot has a control byte which is either EMPTY or 7 bits of
+      /// the hash. Lookups compare GROUPSIZE control bytes at once using
+      /// SSE2/AVX2 and only test candidates with the same 7 bits.
+      /// Uses linear probing with backward shift deletion (no tombstones).
+      /// Not a drop-in speedup for ST, which remains the default table:
+      /// Flat is faster on missing keys but not on hits, and removing is
+      /// several times slower since erase must rescan and shift the rest
+      /// of the cluster. Prefer it only for lookup-heavy tables that see
+      /// many misses and few removes.
+      /// </summary>
+      template<
+         typename T, 
+         typename KEY,
+         size_t   CAPACITY,
+         typename COMPARER,
+         size_t   TABLESIZE = (size_t)ngptwo64(CAPACITY * 2),
+         typename HASHER    = Murmur3>
+      class Flat
+      {
+      private:
+         static_assert(CAPACITY <= TABLESIZE);
+         static_assert(popcnt64_generic(TABLESIZE) == 1U);
+
+      protected:
+         static constexpr size_t  MASK     = TABLESIZE - 1U;
+         static constexpr uint8_t EMPTY    = 0x80U;
+         static constexpr uint8_t SENTINEL = 0xFFU;
+
+         /// <summary>
+         /// Item with its full hash, used to find its home slot when shifting.
+         /// </summary>
+         struct Slot
+         {
+            T        Data;
+            uint32_t Hash;
+         };
+
+         /// <summary>
+         /// Control bytes. The first GROUPSIZE ones are mirrored
+         /// after TABLESIZE so that groups can be loaded unaligned 
+         /// at any index without wrapping. If TABLESIZE is smaller 
+         /// than GROUPSIZE the remaining ones are SENTINEL.
+         /// </summary>
+         CPPCORE_ALIGN64 uint8_t mCtrl[TABLESIZE + GROUPSIZE];
+         CPPCORE_ALIGN16 Slot    mSlots[TABLESIZE];
+         CPPCORE_ALIGN16 size_t  mLength;
+         CPPCORE_ALIGN16 HASHER  mHasher;
+
+         /// <summary>
+         /// C++ Iterator
+         /// </summary>
+         class Iterator
+         {
+         protected:
+            size_t mIdx;
+            Flat&  mHT;
+            INLINE void skip()
+            {
+               while (mIdx < TABLESIZE && (mHT.mCtrl[mIdx] & EMPTY))
+                  mIdx++;
+            }
+         public:
+            INLINE Iterator(size_t idx, Flat& ht) : mIdx(idx), mHT(ht) { skip(); }
+            INLINE Iterator& operator++() { mIdx++; skip(); return *this; }
+            INLINE T& operator*() { return mHT.mSlots[mIdx].Data; }
+            INLINE bool operator!=(const Iterator& end) const { return mIdx != end.mIdx; }
+         };
+
+         /// <summary>
+         /// Hashes key to 32-bit. Low bits select home slot, high 7 bits are the tag.
+         /// </summary>
+         INLINE uint32_t hash(const KEY& key)
+         {
+            typename HASHER::Digest digest;
+            mHasher.hash(key, digest);
+            return (uint32_t)digest;
+         }
+
+         /// <summary>
+         /// Control byte for a used slot from hash.
+         /// </summary>
+         INLINE static uint8_t tag(const uint32_t hash)
+         {
+            return (uint8_t)(hash >> 25);
+         }
+
+         /// <summary>
+         /// Sets control byte at idx and its mirror.
+         /// </summary>
+         INLINE void setCtrl(const size_t idx, const uint8_t v)
+         {
+            mCtrl[idx] = v;
+            if (idx < GROUPSIZE)
+               mCtrl[TABLESIZE + idx] = v;
+         }
+
+         /// <summary>
+         /// Bit i is set if control byte at idx+i equals v.
+         /// </summary>
+         INLINE uint32_t match(const size_t idx, const uint8_t v) const
+         {
+         #if defined(CPPCORE_CPUFEAT_AVX2)
+            return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+               _mm256_loadu_si256((const __m256i*)&mCtrl[idx]),
+               _mm256_set1_epi8((char)v)));
+         #elif defined(CPPCORE_CPUFEAT_SSE2)
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+               _mm_loadu_si128((const __m128i*)&mCtrl[idx]),
+               _mm_set1_epi8((char)v)));
+         #else
+            uint32_t r = 0U;
+            for (size_t i = 0; i < GROUPSIZE; i++)
+               r |= (uint32_t)(mCtrl[idx + i] == v) << i;
+            return r;
+         #endif
+         }
+
+         /// <summary>
+         /// Returns slot index of key or TABLESIZE if not found.
+         /// </summary>
+         INLINE size_t lookup(const KEY& key)
+         {
+            const uint32_t h = hash(key);
+            const uint8_t  t = tag(h);
+            size_t idx = h & MASK;
+            for (size_t n = 0; n < TABLESIZE; n += GROUPSIZE)
+            {
+               // test candidates with same tag
+               uint32_t m = match(idx, t);
+               while (m)
+               {
+                  const size_t i = (idx + CppCore::tzcnt32(m)) & MASK;
+                  if (COMPARER::equal(mSlots[i].Data, key))
+                     return i;
+                  m &= m - 1U;
+               }
+
+               // key can't be behind an empty slot
+               if (match(idx, EMPTY))
+                  break;
+
+               idx = (idx + GROUPSIZE) & MASK;
+            }
+            return TABLESIZE;
+         }
+
+         /// <summary>
+         /// Frees used slot at idx and shifts following items of the
+         /// same cluster back if that moves them closer to their home.
+         /// </summary>
+         INLINE void erase(size_t idx)
+         {
+            // free it first, so a full table stops at it after one cycle
+            setCtrl(idx, EMPTY);
+            mLength--;
+
+            size_t i = idx;
+            while (true)
+            {
+               i = (i + 1U) & MASK;
+               if (mCtrl[i] == EMPTY)
+                  break;
+
+               // keep item if its home is in (idx, i]
+               const size_t home = mSlots[i].Hash & MASK;
+               if (((i - home) & MASK) < ((i - idx) & MASK))
+                  continue;
+
+               // move it to the free slot
+               mSlots[idx] = mSlots[i];
+               setCtrl(idx, mCtrl[i]);
+               setCtrl(i, EMPTY);
+               idx = i;
+            }
+         }
+
+      public:
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE Flat() : mLength(0), mHasher()
+         {
+            clear();
+         }
+
+         /// <summary>
+         /// Iterator begin()
+         /// </summary>
+         INLINE Iterator begin() { return Iterator(0, *this); }
+
+         /// <summary>
+         /// Iterator end()
+         /// </summary>
+         INLINE Iterator end() { return Iterator(TABLESIZE, *this); }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE size_t size() const { return TABLESIZE; }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE size_t length() const { return mLength; }
+
+         /// <summary>
+         /// Marks all slots as empty.
+         /// Complexity: O(SIZE)
+         /// </summary>
+         INLINE void clear()
+         {
+            for (size_t i = 0; i < TABLESIZE; i++)
+               mCtrl[i] = EMPTY;
+            for (size_t i = 0; i < GROUPSIZE; i++)
+               mCtrl[TABLESIZE + i] = (i < TABLESIZE) ? EMPTY : SENTINEL;
+            mLength = 0;
+         }
+
+         /// <summary>
+         /// Complexity: O(1) - O(n)
+         /// </summary>
+         INLINE T* find(const KEY& key)
+         {
+            const size_t idx = lookup(key);
+            return idx != TABLESIZE ? &mSlots[idx].Data : nullptr;
+         }
+
+         /// <summary>
+         /// Complexity: O(1) - O(n)
+         /// </summary>
+         INLINE bool find(const KEY& key, T& item)
+         {
+            if (T* r = find(key))
+            {
+               item = *r;
+               return true;
+            }
+            else
+               return false;
+         }
+
+         /// <summary>
+         /// Uses assignment operator to copy item to slot.
+         /// Fails if CAPACITY items are stored.
+         /// Complexity: O(1) - O(n)
+         /// </summary>
+         INLINE bool insert(const KEY& key, const T& item)
+         {
+            if (mLength >= CAPACITY)
+               return false;
+
+            const uint32_t h = hash(key);
+            size_t idx = h & MASK;
+
+            // there is always an empty slot
+            while (true)
+            {
+               if (const uint32_t m = match(idx, EMPTY))
+               {
+                  idx = (idx + CppCore::tzcnt32(m)) & MASK;
+                  mSlots[idx].Data = item;
+                  mSlots[idx].Hash = h;
+                  setCtrl(idx, tag(h));
+                  mLength++;
+                  return true;
+               }
+               idx = (idx + GROUPSIZE) & MASK;
+            }
+         }
+
+         /// <summary>
+         /// Tries to remove an item from the HashTable.
+         /// Complexity: O(1) - O(n)
+         /// </summary>
+         INLINE bool remove(const KEY& key, T& item)
+         {
+            const size_t idx = lookup(key);
+            if (idx == TABLESIZE)
+               return false;
+            item = mSlots[idx].Data;
+            erase(idx);
+            return true;
+         }
+
+         /// <summary>
+         /// Tries to remove an item from the HashTable.
+         /// Complexity: O(1) - O(n)
+         /// </summary>
+         INLINE bool remove(const KEY& key)
+         {
+            const size_t idx = lookup(key);
+            if (idx == TABLESIZE)
+               return false;
+            erase(idx);
+            return true;
+         }
+
+         /// <summary>
+         /// Same as remove(key). For compatibility with ST.
+         /// </summary>
+         INLINE bool removeAndPushFree(const KEY& key)
+         {
+            return remove(key);
+         }
+
+         /// <summary>
+         /// Dynamically determines the amount of items not stored in their 
+         /// home slot and the highest distance of an item from its home.
+         /// Complexity: O(SIZE)
+         /// </summary>
+         INLINE void collisions(size_t& collisions, size_t& worst)
+         {
+            collisions = 0;
+            worst = 0;
+
+            for (size_t i = 0; i < TABLESIZE; i++)
+            {
+               if (!(mCtrl[i] & EMPTY))
+               {
+                  const size_t tmp = (i - mSlots[i].Hash) & MASK;
+                  if (tmp)
+                     collisions++;
+                  if (tmp > worst)
+                     worst = tmp;
+               }
+            }
+         }
+      };
+
    #ifndef CPPCORE_NO_THREADING
       /// <summary>
-      /// HashTable for Multi Threaded Access
+      /// HashTable for Multi Threaded Access.
+      /// Same chained buckets and pool backed entries as ST, but instead
+      /// of one lock for the whole table, each range of TABLESIZE/STRIPES
+      /// adjacent buckets has its own lock on its own cache line.
+      /// Operations on keys in different stripes run in parallel.
+      /// Ranges are used (and not every n-th bucket) so that threads 
+      /// working in different stripes don't share cache lines of the table.
       /// </summary>
       template<
          typename T, 
@@ -387,43 +735,223 @@ namespace CppCore
          size_t   POOLSIZE,
          typename COMPARER,
          size_t   TABLESIZE = (size_t)ngptwo64(POOLSIZE * 2),
-         typename HASHER    = Murmur3>
-      class MT : ST<T, KEY, POOLSIZE, COMPARER, TABLESIZE, HASHER>
+         typename HASHER    = Murmur3,
+         size_t   STRIPES   = TABLESIZE < 64U ? TABLESIZE : 64U>
+      class MT
       {
+      private:
+         static_assert(POOLSIZE <= TABLESIZE);
+         static_assert(popcnt64_generic(TABLESIZE) == 1U);
+         static_assert(popcnt64_generic(STRIPES) == 1U);
+         static_assert(STRIPES <= TABLESIZE);
+         static constexpr size_t BUCKETS = TABLESIZE / STRIPES;
+
       public:
-         using Base = ST<T, KEY, POOLSIZE, COMPARER, TABLESIZE, HASHER>;
+         /// <summary>
+         /// Pool of entries, without magazines so that any thread
+         /// can insert until all POOLSIZE entries are used.
+         /// </summary>
+         using EntryPool = Pool::Fix::MT<Entry<T>, POOLSIZE>;
+
       protected:
-         CPPCORE_MUTEX_TYPE mLock;
+         /// <summary>
+         /// Lock for a range of buckets
+         /// </summary>
+         class CPPCORE_ALIGN64 Stripe
+         {
+         public:
+            CPPCORE_MUTEX_TYPE mLock;
+            INLINE Stripe() { CPPCORE_MUTEX_INIT(mLock); }
+            INLINE ~Stripe() { CPPCORE_MUTEX_DELETE(mLock); }
+         };
+
+         CPPCORE_ALIGN64 Stripe         mStripes[STRIPES];
+         CPPCORE_ALIGN64 Entry<T>*      mTable[TABLESIZE];
+         CPPCORE_ALIGN64 atomic<size_t> mLength;
+         CPPCORE_ALIGN64 EntryPool      mPool;
+
+         /// <summary>
+         /// Bucket index of key. Uses a local hasher, it's not thread-safe.
+         /// </summary>
+         INLINE static size_t index(const KEY& key)
+         {
+            typename HASHER::Digest hash;
+            HASHER hasher;
+            hasher.hash(key, hash);
+            return (size_t)(hash % TABLESIZE);
+         }
+
+         /// <summary>
+         /// Stripe of bucket index
+         /// </summary>
+         INLINE Stripe& stripe(const size_t idx)
+         {
+            return mStripes[idx / BUCKETS];
+         }
+
+         /// <summary>
+         /// Unlinks entry with key from bucket idx.
+         /// Stripe of idx must be locked.
+         /// </summary>
+         INLINE Entry<T>* unlink(const size_t idx, const KEY& key)
+         {
+            Entry<T>* entry = mTable[idx];
+            Entry<T>* prev = 0;
+            while (entry)
+            {
+               if (COMPARER::equal(entry->Data, key))
+               {
+                  if (prev) prev->Next = entry->Next;
+                  else      mTable[idx] = entry->Next;
+                  return entry;
+               }
+               prev = entry;
+               entry = entry->Next;
+            }
+            return nullptr;
+         }
+
       public:
-         INLINE MT() : Base() { CPPCORE_MUTEX_INIT(mLock); }
-         INLINE ~MT() { CPPCORE_MUTEX_DELETE(mLock); }
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE MT() : mLength(0), mPool()
+         {
+            CppCore::clear(mTable);
+         }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
          INLINE size_t size() const { return TABLESIZE; }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE size_t length() const { return mLength.load(); }
+
+         /// <summary>
+         /// Number of locks
+         /// </summary>
+         INLINE size_t stripes() const { return STRIPES; }
+
+         /// <summary>
+         /// Clears the hashtable stripe by stripe and 
+         /// pushes back all used entries to the pool.
+         /// </summary>
          INLINE void clear()
          {
-            CPPCORE_MUTEX_LOCK(mLock);
-            Base::clear();
-            CPPCORE_MUTEX_UNLOCK(mLock);
+            for (size_t s = 0; s < STRIPES; s++)
+            {
+               Stripe& stripe = mStripes[s];
+               size_t n = 0;
+               CPPCORE_MUTEX_LOCK(stripe.mLock);
+               for (size_t i = s * BUCKETS; i < (s + 1U) * BUCKETS; i++)
+               {
+                  Entry<T>* entry = mTable[i];
+                  while (entry)
+                  {
+                     Entry<T>* next = entry->Next;
+                     mPool.pushBack(entry);
+                     entry = next;
+                     n++;
+                  }
+                  mTable[i] = 0;
+               }
+               CPPCORE_MUTEX_UNLOCK(stripe.mLock);
+               mLength -= n;
+            }
          }
+
+         /// <summary>
+         /// Copies the item with key if found.
+         /// Complexity: O(1) - O(n)
+         /// </summary>
          INLINE bool find(const KEY& key, T& item)
          {
-            CPPCORE_MUTEX_LOCK(mLock);
-            bool ret = Base::find(key, item);
-            CPPCORE_MUTEX_UNLOCK(mLock);
-            return ret;
+            const size_t idx = index(key);
+            Stripe& s = stripe(idx);
+            bool found = false;
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            Entry<T>* entry = mTable[idx];
+            while (entry)
+            {
+               if (COMPARER::equal(entry->Data, key))
+               {
+                  item = entry->Data;
+                  found = true;
+                  break;
+               }
+               entry = entry->Next;
+            }
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            return found;
          }
+
+         /// <summary>
+         /// Uses assignment operator to copy item to entry data.
+         /// Entry is taken from pool before the stripe is locked.
+         /// Complexity: O(1)
+         /// </summary>
          INLINE bool insert(const KEY& key, const T& item)
          {
-            CPPCORE_MUTEX_LOCK(mLock);
-            bool ret = Base::insert(key, item);
-            CPPCORE_MUTEX_UNLOCK(mLock);
-            return ret;
+            Entry<T>* entry;
+
+            // must have empty slot
+            if (!mPool.popBack(entry))
+               return false;
+
+            // set data on entry
+            entry->Data = item;
+
+            // link as first in bucket
+            const size_t idx = index(key);
+            Stripe& s = stripe(idx);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            entry->Next = mTable[idx];
+            mTable[idx] = entry;
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            mLength++;
+            return true;
          }
+
+         /// <summary>
+         /// Tries to remove an item from the HashTable.
+         /// Copies the removed item and pushes its entry back to the pool.
+         /// Complexity: O(1) - O(n)
+         /// </summary>
          INLINE bool remove(const KEY& key, T& item)
          {
-            CPPCORE_MUTEX_LOCK(mLock);
-            bool ret = Base::remove(key, item);
-            CPPCORE_MUTEX_UNLOCK(mLock);
-            return ret;
+            const size_t idx = index(key);
+            Stripe& s = stripe(idx);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            Entry<T>* entry = unlink(idx, key);
+            if (entry)
+               item = entry->Data;
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            if (!entry)
+               return false;
+            mPool.pushBack(entry);
+            mLength--;
+            return true;
+         }
+
+         /// <summary>
+         /// Tries to remove an item from the HashTable and
+         /// pushes it back to the free ones directly.
+         /// </summary>
+         INLINE bool removeAndPushFree(const KEY& key)
+         {
+            const size_t idx = index(key);
+            Stripe& s = stripe(idx);
+            CPPCORE_MUTEX_LOCK(s.mLock);
+            Entry<T>* entry = unlink(idx, key);
+            CPPCORE_MUTEX_UNLOCK(s.mLock);
+            if (!entry)
+               return false;
+            mPool.pushBack(entry);
+            mLength--;
+            return true;
          }
       };
    #endif
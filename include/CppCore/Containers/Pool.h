@@ -63,27 +63,300 @@ namespace CppCore
 
       #ifndef CPPCORE_NO_THREADING
          /// <summary>
-         /// Pool for Multi Thread Access with internal Locking
+         /// Lock-Free Pool for Multi Thread Access.
+         /// Free items are kept on a shared Treiber stack of item indices with an
+         /// ABA tag in the upper half of the head. By default all SIZE items are
+         /// always obtainable from any thread.
+         /// Opt-in with MAGSIZE >= 2: In front of the stack, each of up to SLOTS
+         /// threads owns a small cache (magazine) of MAGSIZE free items, so
+         /// popBack() and pushBack() are a thread local index bump in the common
+         /// case. Magazines refill from and drain to the shared stack in batches
+         /// of MAGSIZE/2 with a single CAS and are drained when their thread exits.
+         /// Further threads use the shared stack directly.
+         /// BEWARE: With magazines popBack() can fail while up to SLOTS*MAGSIZE
+         /// items are cached by other threads. Only use them if the pool is larger
+         /// than what its users can hold at once by that amount, see MTCached.
          /// </summary>
-         template<class T, size_t SIZE>
-         class MT : Base<T, SIZE>, public Array::Fix::MT<T*, SIZE>
+         template<class T, size_t SIZE, size_t SLOTS = 16U, size_t MAGSIZE = 0U>
+         class MT : Base<T, SIZE>
          {
+            static_assert(SIZE > 0 && SIZE < 0xFFFFFFFFU);
+            static_assert(SLOTS > 0);
+
+         protected:
+            static constexpr uint32_t NIL     = 0xFFFFFFFFU;
+            static constexpr size_t   BATCH   = MAGSIZE / 2U;
+            static constexpr size_t   CACHES  = 4U;
+            static constexpr bool     CACHING = MAGSIZE >= 2U;
+
+            /// <summary>
+            /// Cache of free item indices owned by one thread
+            /// </summary>
+            class CPPCORE_ALIGN64 Magazine
+            {
+            public:
+               atomic<bool> mUsed;
+               uint32_t     mLength;
+               uint32_t     mItems[CACHING ? MAGSIZE : 1U];
+               INLINE Magazine() : mUsed(false), mLength(0) { }
+            };
+
+            /// <summary>
+            /// Magazine of a thread in a pool, identified by address and id.
+            /// The id tells apart a pool created at the address of a deleted one.
+            /// </summary>
+            struct Cache
+            {
+               MT*       pool;
+               uint64_t  id;
+               Magazine* magazine;
+            };
+
+            /// <summary>
+            /// Per thread, direct mapped by pool id.
+            /// Gives back the magazines when the thread exits.
+            /// </summary>
+            class ThreadCaches
+            {
+            public:
+               Cache mEntries[CACHES];
+               INLINE ThreadCaches() { CppCore::clear(mEntries); }
+               INLINE ~ThreadCaches()
+               {
+                  for (size_t i = 0; i < CACHES; i++)
+                     MT::detach(mEntries[i]);
+               }
+            };
+
+            CPPCORE_ALIGN64 atomic<uint64_t> mHead;
+            CPPCORE_ALIGN64 Magazine         mMagazines[CACHING ? SLOTS : 1U];
+            CPPCORE_ALIGN64 atomic<uint32_t> mNext[SIZE];
+            const uint64_t mId;
+            MT*            mPrevAlive;
+            MT*            mNextAlive;
+
+            /// <summary>
+            /// Lock for the list of alive pools of this type
+            /// </summary>
+            INLINE static mutex& aliveLock()
+            {
+               static mutex lock;
+               return lock;
+            }
+
+            /// <summary>
+            /// First in list of alive pools of this type
+            /// </summary>
+            INLINE static MT*& aliveHead()
+            {
+               static MT* head = nullptr;
+               return head;
+            }
+
+            /// <summary>
+            /// Unique id for a new pool
+            /// </summary>
+            INLINE static uint64_t nextId()
+            {
+               static atomic<uint64_t> counter(1);
+               return counter.fetch_add(1U, ::std::memory_order_relaxed);
+            }
+
+            /// <summary>
+            /// Caches of calling thread
+            /// </summary>
+            INLINE static ThreadCaches& threadCaches()
+            {
+               static thread_local ThreadCaches caches;
+               return caches;
+            }
+
+            /// <summary>
+            /// Gives back the magazine of a cache entry if its pool is still alive.
+            /// </summary>
+            INLINE static void detach(Cache& c)
+            {
+               if (!c.pool)
+                  return;
+               if (c.magazine)
+               {
+                  unique_lock<mutex> lock(aliveLock());
+                  for (MT* p = aliveHead(); p; p = p->mNextAlive)
+                  {
+                     if (p == c.pool && p->mId == c.id)
+                     {
+                        Magazine& m = *c.magazine;
+                        if (m.mLength)
+                           p->pushShared(m.mItems, m.mLength);
+                        m.mLength = 0;
+                        m.mUsed.store(false, ::std::memory_order_release);
+                        break;
+                     }
+                  }
+               }
+               c.pool = nullptr;
+               c.id = 0;
+               c.magazine = nullptr;
+            }
+
+            /// <summary>
+            /// Slow path of magazine() on first use of the pool by a thread.
+            /// Takes over the cache entry and tries to get a free magazine.
+            /// </summary>
+            INLINE Magazine* attach(Cache& c)
+            {
+               detach(c);
+               c.pool = this;
+               c.id = mId;
+               for (size_t i = 0; i < SLOTS; i++)
+               {
+                  bool expected = false;
+                  if (mMagazines[i].mUsed.compare_exchange_strong(expected, true, 
+                     ::std::memory_order_acquire))
+                  {
+                     c.magazine = &mMagazines[i];
+                     break;
+                  }
+               }
+               return c.magazine;
+            }
+
+            /// <summary>
+            /// Magazine of calling thread or nullptr if it has none.
+            /// </summary>
+            INLINE Magazine* magazine()
+            {
+               if (!CACHING)
+                  return nullptr;
+               Cache& c = threadCaches().mEntries[mId % CACHES];
+               return (c.pool == this && c.id == mId) ? c.magazine : attach(c);
+            }
+
+            /// <summary>
+            /// Pushes n indices as one chain to the shared stack.
+            /// </summary>
+            INLINE void pushShared(const uint32_t* idx, const size_t n)
+            {
+               for (size_t i = 1; i < n; i++)
+                  mNext[idx[i-1]].store(idx[i], ::std::memory_order_relaxed);
+               uint64_t head = mHead.load(::std::memory_order_relaxed);
+               uint64_t next;
+               do
+               {
+                  mNext[idx[n-1]].store((uint32_t)head, ::std::memory_order_relaxed);
+                  next = (((head >> 32) + 1U) << 32) | idx[0];
+               } while (!mHead.compare_exchange_weak(head, next,
+                  ::std::memory_order_release, ::std::memory_order_relaxed));
+            }
+
+            /// <summary>
+            /// Pops up to n indices as one chain from the shared stack.
+            /// The chain is valid if the tagged head did not change meanwhile.
+            /// </summary>
+            INLINE size_t popShared(uint32_t* idx, const size_t n)
+            {
+               uint64_t head = mHead.load(::std::memory_order_acquire);
+               while (true)
+               {
+                  uint32_t cur = (uint32_t)head;
+                  size_t   num = 0;
+                  while (num < n && cur < SIZE)
+                  {
+                     idx[num++] = cur;
+                     cur = mNext[cur].load(::std::memory_order_relaxed);
+                  }
+                  if (num == 0)
+                     return 0;
+                  if (cur != NIL && cur >= SIZE)
+                  {
+                     // read from a changing chain
+                     head = mHead.load(::std::memory_order_acquire);
+                     continue;
+                  }
+                  const uint64_t next = (((head >> 32) + 1U) << 32) | cur;
+                  if (mHead.compare_exchange_weak(head, next,
+                     ::std::memory_order_acquire, ::std::memory_order_acquire))
+                     return num;
+               }
+            }
+
          public:
-            INLINE MT() : Base<T, SIZE>(), Array::Fix::MT<T*, SIZE>()
+            INLINE MT() : Base<T, SIZE>(), mId(nextId()), mPrevAlive(nullptr)
             {
-               // push the items from the pool on the stack
-               for (size_t i = 0; i < SIZE; i++)
-                  Array::Fix::MT<T*, SIZE>::pushBack(&Base<T, SIZE>::mPool[i]);
+               // chain all items on the shared stack
+               for (size_t i = 0; i < SIZE - 1U; i++)
+                  mNext[i].store((uint32_t)(i + 1U), ::std::memory_order_relaxed);
+               mNext[SIZE - 1U].store(NIL, ::std::memory_order_relaxed);
+               mHead.store(0, ::std::memory_order_release);
+
+               // add to alive ones
+               unique_lock<mutex> lock(aliveLock());
+               mNextAlive = aliveHead();
+               if (mNextAlive)
+                  mNextAlive->mPrevAlive = this;
+               aliveHead() = this;
             }
+            INLINE ~MT()
+            {
+               // remove from alive ones, threads don't give back magazines anymore
+               unique_lock<mutex> lock(aliveLock());
+               if (mPrevAlive) mPrevAlive->mNextAlive = mNextAlive;
+               else            aliveHead() = mNextAlive;
+               if (mNextAlive)
+                  mNextAlive->mPrevAlive = mPrevAlive;
+            }
+
+            /// <summary>
+            /// Pushes an item back to the pool. 
+            /// Returns false if it does not belong to the pool.
+            /// </summary>
             INLINE bool pushBack(T* item)
             {
-               return Array::Fix::MT<T*, SIZE>::pushBack(item);
+               if (item < &this->mPool[0] || item >= &this->mPool[SIZE])
+                  return false;
+               const uint32_t idx = (uint32_t)(item - &this->mPool[0]);
+               if (Magazine* m = magazine())
+               {
+                  if (m->mLength == MAGSIZE)
+                  {
+                     m->mLength -= (uint32_t)BATCH;
+                     pushShared(&m->mItems[m->mLength], BATCH);
+                  }
+                  m->mItems[m->mLength++] = idx;
+               }
+               else
+                  pushShared(&idx, 1U);
+               return true;
             }
+
+            /// <summary>
+            /// Pops an item from the pool. 
+            /// Returns false if no free item was found.
+            /// </summary>
             INLINE bool popBack(T*& item)
             {
-               return Array::Fix::MT<T*, SIZE>::popBack(item);
+               uint32_t idx;
+               if (Magazine* m = magazine())
+               {
+                  if (!m->mLength && !(m->mLength = (uint32_t)popShared(m->mItems, BATCH)))
+                     return false;
+                  idx = m->mItems[--m->mLength];
+               }
+               else if (!popShared(&idx, 1U))
+                  return false;
+               item = &this->mPool[idx];
+               return true;
             }
+
+            INLINE T* getPoolPtr() { return &this->mPool[0]; }
          };
+
+         /// <summary>
+         /// Pool::Fix::MT with magazines hiding up to a quarter of SIZE.
+         /// </summary>
+         template<class T, size_t SIZE, size_t SLOTS = 16U>
+         using MTCached = MT<T, SIZE, SLOTS, 
+            SIZE / (SLOTS * 4U) < 32U ? SIZE / (SLOTS * 4U) : 32U>;
       #endif
       };
 
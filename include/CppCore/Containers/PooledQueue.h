@@ -56,7 +56,9 @@ namespace CppCore
          };
 
          /// <summary>
-         /// Pooled Queue for Multi Thread Access
+         /// Pooled Queue for Multi Thread Access.
+         /// Its pool has no magazines, items freed by the consumer
+         /// thread must be available to the producer thread again.
          /// </summary>
          template<class T, size_t SIZE>
          class MT : public Queue::MT<T*, SIZE>
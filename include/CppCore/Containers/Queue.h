@@ -8,7 +8,7 @@ namespace CppCore
 {
    /// <summary>
    /// Fixed Size FIFO Queue.
-   /// Use nested classes ST and MT.
+   /// Use nested classes ST and MT or the lock-free MPMC and SPSC.
    /// </summary>
    class Queue
    {
@@ -581,6 +581,230 @@ namespace CppCore
             return ret;
          }
       };
+
+      /// <summary>
+      /// Lock-Free FIFO Queue for Multiple Producers and Multiple Consumers.
+      /// Bounded ring buffer with a sequence number per slot (D. Vyukov).
+      /// SIZE must be a power of two and at least 2.
+      /// </summary>
+      /// <remarks>
+      /// Only pushBack() and popFront() are supported.
+      /// The length() is a snapshot and can be outdated the moment it returns.
+      /// </remarks>
+      template<typename T, size_t SIZE>
+      class MPMC
+      {
+         static_assert(SIZE > 1 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two and at least 2");
+
+      protected:
+         static constexpr size_t MASK = SIZE - 1;
+
+         /// <summary>
+         /// Slot with sequence number
+         /// </summary>
+         struct Cell
+         {
+            atomic<size_t> seq;
+            T              data;
+         };
+
+         CPPCORE_ALIGN64 Cell           mCells[SIZE];
+         CPPCORE_ALIGN64 atomic<size_t> mIdxEnqueue;
+         CPPCORE_ALIGN64 atomic<size_t> mIdxDequeue;
+
+      public:
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE MPMC() : mIdxEnqueue(0), mIdxDequeue(0)
+         {
+            for (size_t i = 0; i < SIZE; i++)
+               mCells[i].seq.store(i, ::std::memory_order_relaxed);
+         }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE size_t size() const { return SIZE; }
+
+         /// <summary>
+         /// BEWARE: You must consider the returned value already outdated/invalid.
+         /// This is for e.g. monitoring usage only.
+         /// </summary>
+         INLINE size_t length() const
+         {
+            const size_t DEQ = mIdxDequeue.load(::std::memory_order_relaxed);
+            const size_t ENQ = mIdxEnqueue.load(::std::memory_order_relaxed);
+            return ENQ > DEQ ? ENQ - DEQ : 0;
+         }
+
+         /// <summary>
+         /// Complexity: O(1). Lock-Free.
+         /// </summary>
+         INLINE bool pushBack(const T& item)
+         {
+            size_t pos = mIdxEnqueue.load(::std::memory_order_relaxed);
+            Cell* cell;
+            while (true)
+            {
+               cell = &mCells[pos & MASK];
+               const size_t   SEQ = cell->seq.load(::std::memory_order_acquire);
+               const intptr_t DIF = (intptr_t)SEQ - (intptr_t)pos;
+
+               // slot free, try to claim it
+               if (DIF == 0)
+               {
+                  if (mIdxEnqueue.compare_exchange_weak(pos, pos + 1, ::std::memory_order_relaxed))
+                     break;
+               }
+
+               // full
+               else if (DIF < 0)
+                  return false;
+
+               // claimed by other producer, retry
+               else
+                  pos = mIdxEnqueue.load(::std::memory_order_relaxed);
+            }
+            cell->data = item;
+            cell->seq.store(pos + 1, ::std::memory_order_release);
+            return true;
+         }
+
+         /// <summary>
+         /// Complexity: O(1). Lock-Free.
+         /// </summary>
+         INLINE bool popFront(T& item)
+         {
+            size_t pos = mIdxDequeue.load(::std::memory_order_relaxed);
+            Cell* cell;
+            while (true)
+            {
+               cell = &mCells[pos & MASK];
+               const size_t   SEQ = cell->seq.load(::std::memory_order_acquire);
+               const intptr_t DIF = (intptr_t)SEQ - (intptr_t)(pos + 1);
+
+               // slot filled, try to claim it
+               if (DIF == 0)
+               {
+                  if (mIdxDequeue.compare_exchange_weak(pos, pos + 1, ::std::memory_order_relaxed))
+                     break;
+               }
+
+               // empty
+               else if (DIF < 0)
+                  return false;
+
+               // claimed by other consumer, retry
+               else
+                  pos = mIdxDequeue.load(::std::memory_order_relaxed);
+            }
+            item = cell->data;
+            cell->seq.store(pos + MASK + 1, ::std::memory_order_release);
+            return true;
+         }
+
+         /// <summary>
+         /// Removes all items by popping them.
+         /// </summary>
+         INLINE void clear()
+         {
+            T item;
+            while (popFront(item)) { }
+         }
+      };
+
+      /// <summary>
+      /// Lock-Free FIFO Queue for exactly one Producer and one Consumer thread.
+      /// Cheaper than MPMC because there is no contention on the indices.
+      /// SIZE must be a power of two.
+      /// </summary>
+      /// <remarks>
+      /// pushBack() must only be called by the producer, popFront() and clear() only by the consumer.
+      /// </remarks>
+      template<typename T, size_t SIZE>
+      class SPSC
+      {
+         static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two");
+
+      protected:
+         static constexpr size_t MASK = SIZE - 1;
+
+         CPPCORE_ALIGN64 T              mData[SIZE];
+         CPPCORE_ALIGN64 atomic<size_t> mIdxEnqueue;       // written by producer
+         size_t                         mIdxDequeueCached; // producer's view of mIdxDequeue
+         CPPCORE_ALIGN64 atomic<size_t> mIdxDequeue;       // written by consumer
+         size_t                         mIdxEnqueueCached; // consumer's view of mIdxEnqueue
+
+      public:
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE SPSC() :
+            mIdxEnqueue(0),
+            mIdxDequeueCached(0),
+            mIdxDequeue(0),
+            mIdxEnqueueCached(0) { }
+
+         /// <summary>
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE size_t size() const { return SIZE; }
+
+         /// <summary>
+         /// BEWARE: You must consider the returned value already outdated/invalid.
+         /// This is for e.g. monitoring usage only.
+         /// </summary>
+         INLINE size_t length() const
+         {
+            const size_t DEQ = mIdxDequeue.load(::std::memory_order_relaxed);
+            const size_t ENQ = mIdxEnqueue.load(::std::memory_order_relaxed);
+            return ENQ > DEQ ? ENQ - DEQ : 0;
+         }
+
+         /// <summary>
+         /// Complexity: O(1). Wait-Free. Producer only.
+         /// </summary>
+         INLINE bool pushBack(const T& item)
+         {
+            const size_t POS = mIdxEnqueue.load(::std::memory_order_relaxed);
+            if (POS - mIdxDequeueCached == SIZE)
+            {
+               mIdxDequeueCached = mIdxDequeue.load(::std::memory_order_acquire);
+               if (POS - mIdxDequeueCached == SIZE)
+                  return false;
+            }
+            mData[POS & MASK] = item;
+            mIdxEnqueue.store(POS + 1, ::std::memory_order_release);
+            return true;
+         }
+
+         /// <summary>
+         /// Complexity: O(1). Wait-Free. Consumer only.
+         /// </summary>
+         INLINE bool popFront(T& item)
+         {
+            const size_t POS = mIdxDequeue.load(::std::memory_order_relaxed);
+            if (POS == mIdxEnqueueCached)
+            {
+               mIdxEnqueueCached = mIdxEnqueue.load(::std::memory_order_acquire);
+               if (POS == mIdxEnqueueCached)
+                  return false;
+            }
+            item = mData[POS & MASK];
+            mIdxDequeue.store(POS + 1, ::std::memory_order_release);
+            return true;
+         }
+
+         /// <summary>
+         /// Removes all items by popping them. Consumer only.
+         /// </summary>
+         INLINE void clear()
+         {
+            T item;
+            while (popFront(item)) { }
+         }
+      };
    #endif
    };
 }
@@ -16,6 +16,12 @@ namespace CppCore
    template<uint32_t ROUNDS>
    class AES
    {
+   public:
+      /// <summary>
+      /// Number of Rounds
+      /// </summary>
+      static constexpr const uint32_t NROUNDS = ROUNDS;
+
    protected:
       static_assert(
          ROUNDS == CPPCORE_AES_ROUNDS_128 ||
@@ -660,6 +666,250 @@ namespace CppCore
       }
    };
 
+   /////////////////////////////////////////////////////////////////////////////////////////////////
+   // GCM GENERIC
+   /////////////////////////////////////////////////////////////////////////////////////////////////
+
+   /// <summary>
+   /// GHASH Generic. Multiplication by H in GF(2^128) using
+   /// 4-Bit tables (Shoup's method) with 16 precomputed multiples of H.
+   /// </summary>
+   class CPPCORE_ALIGN16 GHASHg
+   {
+   protected:
+      /// <summary>
+      /// Reduction of the four bits shifted out per step
+      /// </summary>
+      static constexpr const uint64_t R4[16] = {
+         0x0000ULL << 48, 0x1C20ULL << 48, 0x3840ULL << 48, 0x2460ULL << 48,
+         0x7080ULL << 48, 0x6CA0ULL << 48, 0x48C0ULL << 48, 0x54E0ULL << 48,
+         0xE100ULL << 48, 0xFD20ULL << 48, 0xD940ULL << 48, 0xC560ULL << 48,
+         0x9180ULL << 48, 0x8DA0ULL << 48, 0xA9C0ULL << 48, 0xB5E0ULL << 48
+      };
+
+      uint64_t hh[16];
+      uint64_t hl[16];
+
+   public:
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE GHASHg() { }
+
+      /// <summary>
+      /// Constructor. H must be 16 Bytes.
+      /// </summary>
+      INLINE GHASHg(const void* h) { reset(h); }
+
+      /// <summary>
+      /// Builds the tables for the 16 Bytes hash key H.
+      /// </summary>
+      INLINE void reset(const void* h)
+      {
+         uint64_t vh = CppCore::loadr64(&((uint64_t*)h)[0]);
+         uint64_t vl = CppCore::loadr64(&((uint64_t*)h)[1]);
+         hh[0] = 0ULL; hl[0] = 0ULL;
+         hh[8] = vh;   hl[8] = vl;
+         for (uint32_t i = 4U; i > 0U; i >>= 1)
+         {
+            const uint64_t t = (0ULL - (vl & 1ULL)) & 0xE100000000000000ULL;
+            vl = (vh << 63) | (vl >> 1);
+            vh = (vh >> 1) ^ t;
+            hh[i] = vh;
+            hl[i] = vl;
+         }
+         for (uint32_t i = 2U; i <= 8U; i <<= 1)
+         {
+            for (uint32_t j = 1U; j < i; j++)
+            {
+               hh[i+j] = hh[i] ^ hh[j];
+               hl[i+j] = hl[i] ^ hl[j];
+            }
+         }
+      }
+
+      /// <summary>
+      /// Multiplies y with H in GF(2^128).
+      /// </summary>
+      INLINE void mul(Block128& y) const
+      {
+         uint32_t lo  = y.u8[15] & 0x0FU;
+         uint32_t hi  = y.u8[15] >> 4;
+         uint64_t zh  = hh[lo];
+         uint64_t zl  = hl[lo];
+         uint32_t rem = zl & 0x0FU;
+         zl = (zh << 60) | (zl >> 4);
+         zh = (zh >> 4) ^ R4[rem] ^ hh[hi];
+         zl ^= hl[hi];
+         for (int i = 14; i >= 0; i--)
+         {
+            lo  = y.u8[i] & 0x0FU;
+            hi  = y.u8[i] >> 4;
+            rem = zl & 0x0FU;
+            zl  = (zh << 60) | (zl >> 4);
+            zh  = (zh >> 4) ^ R4[rem] ^ hh[lo];
+            zl ^= hl[lo];
+            rem = zl & 0x0FU;
+            zl  = (zh << 60) | (zl >> 4);
+            zh  = (zh >> 4) ^ R4[rem] ^ hh[hi];
+            zl ^= hl[hi];
+         }
+         CppCore::storer64(&y.u64[0], zh);
+         CppCore::storer64(&y.u64[1], zl);
+      }
+
+      /// <summary>
+      /// Absorbs len Bytes of data into the GHASH state y.
+      /// A partial last Block is padded with zeros.
+      /// </summary>
+      INLINE void update(Block128& y, const void* data, size_t len) const
+      {
+         const uint8_t* p = (const uint8_t*)data;
+         while (len)
+         {
+            const size_t n = MIN(len, 16U);
+            y.xor_(p, n);
+            mul(y);
+            p   += n;
+            len -= n;
+         }
+      }
+   };
+
+   /// <summary>
+   /// AES-GCM Generic. Authenticated encryption with 96-Bit IV and 128-Bit Tag.
+   /// Works on top of any AES implementation with encryptECB() and encryptCTR().
+   /// CTR is processed in chunks followed by GHASH on the same chunk while it is still in cache.
+   /// </summary>
+   template<typename TAES>
+   class GCMg
+   {
+   public:
+      static constexpr const size_t IVSIZE  = 12U;
+      static constexpr const size_t TAGSIZE = 16U;
+      static constexpr const size_t CHUNK   = 1024U;
+
+   protected:
+      TAES   aes;
+      GHASHg ghash;
+
+      /// <summary>
+      /// Builds J0 from the 96-Bit IV and the first counter J0+1.
+      /// The 64-Bit increment of encryptCTR() equals the 32-Bit increment
+      /// of GCM below the limit of 2^32-2 Blocks per message.
+      /// </summary>
+      INLINE void init(const void* iv, Block128& j0, Block128& ctr)
+      {
+         ::memcpy(j0.u8, iv, IVSIZE);
+         j0.u8[12] = 0x00; j0.u8[13] = 0x00; j0.u8[14] = 0x00; j0.u8[15] = 0x01;
+         CppCore::clone(ctr, j0);
+         ctr.u8[15] = 0x02;
+      }
+
+      /// <summary>
+      /// Absorbs the length Block and computes the Tag.
+      /// </summary>
+      INLINE void finish(Block128& y, const Block128& j0, size_t aadlen, size_t len, Block128& tag)
+      {
+         Block128 l;
+         CppCore::storer64(&l.u64[0], (uint64_t)aadlen << 3);
+         CppCore::storer64(&l.u64[1], (uint64_t)len << 3);
+         CppCore::xor_(y, l, y);
+         ghash.mul(y);
+         aes.encryptECB(&j0, &tag, 1);
+         CppCore::xor_(tag, y, tag);
+      }
+
+   public:
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE GCMg() { }
+
+      /// <summary>
+      /// Constructor. Key size must match TAES.
+      /// </summary>
+      INLINE GCMg(const void* key) { reset(key); }
+
+      /// <summary>
+      /// Reset with new key
+      /// </summary>
+      INLINE void reset(const void* key)
+      {
+         Block128 h;
+         aes.reset(key, false);
+         CppCore::clear(h);
+         aes.encryptECB(&h, &h, 1);
+         ghash.reset(&h);
+      }
+
+      /// <summary>
+      /// Encrypts len Bytes from in to out and authenticates them together with aadlen Bytes of aad.
+      /// Writes the 16 Bytes Tag to tag. IV must be 12 Bytes and must never repeat for a key.
+      /// </summary>
+      INLINE void encrypt(
+         const void* iv, const void* aad, const size_t aadlen,
+         const void* in, void* out, const size_t len, void* tag)
+      {
+         Block128 j0, ctr, y, t;
+         uint8_t* bin  = (uint8_t*)in;
+         uint8_t* bout = (uint8_t*)out;
+         size_t   n    = len;
+         init(iv, j0, ctr);
+         CppCore::clear(y);
+         ghash.update(y, aad, aadlen);
+         while (n)
+         {
+            const size_t k = MIN(n, CHUNK);
+            aes.encryptCTR(bin, bout, &ctr, k);
+            ghash.update(y, bout, k);
+            bin  += k;
+            bout += k;
+            n    -= k;
+         }
+         finish(y, j0, aadlen, len, t);
+         ::memcpy(tag, &t, TAGSIZE);
+      }
+
+      /// <summary>
+      /// Decrypts len Bytes from in to out and verifies them together with aadlen Bytes of aad against tag.
+      /// Returns false and zeros out if the Tag does not match.
+      /// </summary>
+      INLINE bool decrypt(
+         const void* iv, const void* aad, const size_t aadlen,
+         const void* in, void* out, const size_t len, const void* tag)
+      {
+         Block128 j0, ctr, y, t;
+         uint8_t* bin  = (uint8_t*)in;
+         uint8_t* bout = (uint8_t*)out;
+         size_t   n    = len;
+         init(iv, j0, ctr);
+         CppCore::clear(y);
+         ghash.update(y, aad, aadlen);
+         while (n)
+         {
+            const size_t k = MIN(n, CHUNK);
+            ghash.update(y, bin, k);
+            aes.decryptCTR(bin, bout, &ctr, k);
+            bin  += k;
+            bout += k;
+            n    -= k;
+         }
+         finish(y, j0, aadlen, len, t);
+         t.xor_(tag, TAGSIZE);
+         if ((t.u64[0] | t.u64[1]) != 0ULL)
+         {
+            CppCore::Memory::clear(out, len);
+            return false;
+         }
+         return true;
+      }
+   };
+
+   using AES128GCMg = GCMg<AES128g>;
+   using AES192GCMg = GCMg<AES192g>;
+   using AES256GCMg = GCMg<AES256g>;
+
    /////////////////////////////////////////////////////////////////////////////////////////////////
    // AES-NI
    /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -738,6 +988,118 @@ namespace CppCore
          iv = t;
       }
 
+      /// <summary>
+      /// Encrypts K independent Blocks in ECB mode.
+      /// Rounds are interleaved to keep the AES-NI pipeline busy.
+      /// </summary>
+      template<size_t K>
+      INLINE void encrypt(__m128i* m)
+      {
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_xor_si128(m[j], ek[0]);
+         CPPCORE_UNROLL
+         for (uint32_t i = 1U; i < N; i++)
+         {
+            const __m128i k = ek[i];
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < K; j++)
+               m[j] = _mm_aesenc_si128(m[j], k);
+         }
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_aesenclast_si128(m[j], ek[N]);
+      }
+
+      /// <summary>
+      /// Decrypts K independent Blocks in ECB mode.
+      /// Rounds are interleaved to keep the AES-NI pipeline busy.
+      /// </summary>
+      template<size_t K>
+      INLINE void decrypt(__m128i* m)
+      {
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_xor_si128(m[j], dk[0]);
+         CPPCORE_UNROLL
+         for (uint32_t i = 1U; i < N; i++)
+         {
+            const __m128i k = dk[i];
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < K; j++)
+               m[j] = _mm_aesdec_si128(m[j], k);
+         }
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_aesdeclast_si128(m[j], dk[N]);
+      }
+
+   protected:
+      /// <summary>
+      /// Encrypts or decrypts K Blocks in ECB mode and advances the pointers.
+      /// </summary>
+      template<size_t K, bool ENCRYPT, bool ALIGNED>
+      INLINE void processECB(__m128i*& bin, __m128i*& bout)
+      {
+         __m128i m[K];
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = load<ALIGNED>(bin + j);
+         if (ENCRYPT) encrypt<K>(m);
+         else         decrypt<K>(m);
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            store<ALIGNED>(bout + j, m[j]);
+         bin  += K;
+         bout += K;
+      }
+
+      /// <summary>
+      /// Decrypts K Blocks in CBC mode and advances the pointers.
+      /// All ciphertexts are loaded before storing, so in and out may overlap.
+      /// </summary>
+      template<size_t K, bool ALIGNED>
+      INLINE void processCBCDecrypt(__m128i*& bin, __m128i*& bout, __m128i& iv)
+      {
+         __m128i c[K];
+         __m128i m[K];
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = c[j] = load<ALIGNED>(bin + j);
+         decrypt<K>(m);
+         store<ALIGNED>(bout, _mm_xor_si128(m[0], iv));
+         CPPCORE_UNROLL
+         for (size_t j = 1; j < K; j++)
+            store<ALIGNED>(bout + j, _mm_xor_si128(m[j], c[j-1]));
+         iv    = c[K-1];
+         bin  += K;
+         bout += K;
+      }
+
+      /// <summary>
+      /// Encrypts K Blocks in CTR mode and advances the pointers and counter.
+      /// The counter is kept byte swapped for the 64-Bit increment.
+      /// </summary>
+      template<size_t K, bool ALIGNED>
+      INLINE void processCTR(__m128i*& bin, __m128i*& bout, __m128i& ctr, const __m128i& ONE, const __m128i& BSWAP)
+      {
+         __m128i m[K];
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+         {
+            m[j] = _mm_shuffle_epi8(ctr, BSWAP);
+            ctr  = _mm_add_epi64(ctr, ONE);
+         }
+         encrypt<K>(m);
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            store<ALIGNED>(bout + j, _mm_xor_si128(m[j], load<ALIGNED>(bin + j)));
+         bin  += K;
+         bout += K;
+      }
+
+   public:
+
       ///////////////////////////////////////////////////////////////
 
       /// <summary>
@@ -750,6 +1112,10 @@ namespace CppCore
          __m128i* bout = (__m128i*)out;
          __m128i* bine = bin + n;
          __m128i  m;
+         while (bin + 8U <= bine)
+            processECB<8, true, ALIGNED>(bin, bout);
+         if (bin + 4U <= bine)
+            processECB<4, true, ALIGNED>(bin, bout);
          while (bin < bine)
          {
             m = load<ALIGNED>(bin++);
@@ -768,6 +1134,10 @@ namespace CppCore
          __m128i* bout = (__m128i*)out;
          __m128i* bine = bin + n;
          __m128i  m;
+         while (bin + 8U <= bine)
+            processECB<8, false, ALIGNED>(bin, bout);
+         if (bin + 4U <= bine)
+            processECB<4, false, ALIGNED>(bin, bout);
          while (bin < bine)
          {
             m = load<ALIGNED>(bin++);
@@ -807,6 +1177,10 @@ namespace CppCore
          __m128i* bout = (__m128i*)out;
          __m128i* bine = bin + n;
          __m128i  m;
+         while (bin + 8U <= bine)
+            processCBCDecrypt<8, ALIGNED>(bin, bout, iv);
+         if (bin + 4U <= bine)
+            processCBCDecrypt<4, ALIGNED>(bin, bout, iv);
          while (bin < bine)
          {
             m = load<ALIGNED>(bin++);
@@ -831,6 +1205,16 @@ namespace CppCore
          __m128i* bout = (__m128i*)out;
          __m128i  enc;
 
+         while (len >= 128U)
+         {
+            processCTR<8, ALIGNED>(bin, bout, ctr, ONE, BSWAP);
+            len -= 128U;
+         }
+         if (len >= 64U)
+         {
+            processCTR<4, ALIGNED>(bin, bout, ctr, ONE, BSWAP);
+            len -= 64U;
+         }
          while (len)
          {
             enc = _mm_shuffle_epi8(ctr, BSWAP);
@@ -1125,6 +1509,435 @@ namespace CppCore
          }
       }
    };
+
+#if defined(CPPCORE_CPUFEAT_PCLMUL)
+   /////////////////////////////////////////////////////////////////////////////////////////////////
+   // GCM PCLMUL
+   /////////////////////////////////////////////////////////////////////////////////////////////////
+
+   /// <summary>
+   /// GHASH PCLMUL. Multiplication in GF(2^128) using carry-less multiplication
+   /// on byte reflected values. Keeps H^1 to H^8 to fold up to 8 Blocks with
+   /// a single reduction (aggregated reduction).
+   /// </summary>
+   class CPPCORE_ALIGN64 GHASHs
+   {
+   public:
+      static constexpr const size_t MAXBLOCKS = 8U;
+
+   protected:
+      __m128i h[MAXBLOCKS];
+
+   public:
+      /// <summary>
+      /// Reverses the byte order of the 128-Bit value
+      /// </summary>
+      INLINE static __m128i bswap(const __m128i& v)
+      {
+         return _mm_shuffle_epi8(v, _mm_setr_epi8(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0));
+      }
+
+      /// <summary>
+      /// Reduces the unreduced 256-Bit product (lo, mid, hi) of byte reflected values.
+      /// Since shift and reduction are linear, sums of several products can be reduced at once.
+      /// </summary>
+      INLINE static __m128i reduce(__m128i lo, const __m128i& mid, __m128i hi)
+      {
+         lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+         hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+         // shift left 256-Bit value by one for reflected representation
+         __m128i t1 = _mm_srli_epi32(lo, 31);
+         __m128i t2 = _mm_srli_epi32(hi, 31);
+         __m128i t3 = _mm_srli_si128(t1, 12);
+         lo = _mm_or_si128(_mm_slli_epi32(lo, 1), _mm_slli_si128(t1, 4));
+         hi = _mm_or_si128(_mm_slli_epi32(hi, 1), _mm_slli_si128(t2, 4));
+         hi = _mm_or_si128(hi, t3);
+
+         // reduce modulo x^128 + x^7 + x^2 + x + 1
+         t1 = _mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30));
+         t1 = _mm_xor_si128(t1, _mm_slli_epi32(lo, 25));
+         t2 = _mm_srli_si128(t1, 4);
+         lo = _mm_xor_si128(lo, _mm_slli_si128(t1, 12));
+         t3 = _mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2));
+         t3 = _mm_xor_si128(t3, _mm_srli_epi32(lo, 7));
+         t3 = _mm_xor_si128(t3, t2);
+         lo = _mm_xor_si128(lo, t3);
+         return _mm_xor_si128(hi, lo);
+      }
+
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE GHASHs() { }
+
+      /// <summary>
+      /// Constructor. H must be 16 Bytes.
+      /// </summary>
+      INLINE GHASHs(const void* h) { reset(h); }
+
+      /// <summary>
+      /// Computes the powers H^1 to H^8 for the 16 Bytes hash key H.
+      /// </summary>
+      INLINE void reset(const void* key)
+      {
+         CPPCORE_ALIGN16 __m128i r[2];
+         h[0] = bswap(_mm_loadu_si128((const __m128i*)key));
+         for (size_t i = 1; i < MAXBLOCKS; i++)
+         {
+            CppCore::clmul(h[i-1], h[0], r);
+            h[i] = reduce(r[0], _mm_setzero_si128(), r[1]);
+         }
+      }
+
+      /// <summary>
+      /// Adds the unreduced product of byte reflected x and H^(K-j) to (lo, mid, hi).
+      /// </summary>
+      template<size_t K>
+      INLINE void mul(const __m128i& x, const size_t j, __m128i& lo, __m128i& mid, __m128i& hi) const
+      {
+         static_assert(K >= 1U && K <= MAXBLOCKS);
+         const __m128i& p = h[K-1U-j];
+         lo  = _mm_xor_si128(lo,  _mm_clmulepi64_si128(x, p, 0x00));
+         hi  = _mm_xor_si128(hi,  _mm_clmulepi64_si128(x, p, 0x11));
+         mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(x, p, 0x10));
+         mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(x, p, 0x01));
+      }
+
+      /// <summary>
+      /// Absorbs K Blocks into the byte reflected GHASH state y with a single reduction.
+      /// </summary>
+      template<size_t K>
+      INLINE void update(__m128i& y, const __m128i* x) const
+      {
+         __m128i lo  = _mm_setzero_si128();
+         __m128i mid = _mm_setzero_si128();
+         __m128i hi  = _mm_setzero_si128();
+         mul<K>(_mm_xor_si128(bswap(x[0]), y), 0, lo, mid, hi);
+         CPPCORE_UNROLL
+         for (size_t j = 1; j < K; j++)
+            mul<K>(bswap(x[j]), j, lo, mid, hi);
+         y = reduce(lo, mid, hi);
+      }
+
+      /// <summary>
+      /// Absorbs len Bytes of data into the byte reflected GHASH state y.
+      /// A partial last Block is padded with zeros.
+      /// </summary>
+      INLINE void update(__m128i& y, const void* data, size_t len) const
+      {
+         __m128i  x[MAXBLOCKS];
+         __m128i* p = (__m128i*)data;
+         while (len >= MAXBLOCKS*16U)
+         {
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < MAXBLOCKS; j++)
+               x[j] = _mm_loadu_si128(p + j);
+            update<MAXBLOCKS>(y, x);
+            p   += MAXBLOCKS;
+            len -= MAXBLOCKS*16U;
+         }
+         if (len >= 64U)
+         {
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 4U; j++)
+               x[j] = _mm_loadu_si128(p + j);
+            update<4>(y, x);
+            p   += 4U;
+            len -= 64U;
+         }
+         while (len >= 16U)
+         {
+            x[0] = _mm_loadu_si128(p++);
+            update<1>(y, x);
+            len -= 16U;
+         }
+         if (len)
+         {
+            x[0] = _mm_setzero_si128();
+            ::memcpy(x, p, len);
+            update<1>(y, x);
+         }
+      }
+   };
+
+   /// <summary>
+   /// AES-GCM AES-NI and PCLMUL. Authenticated encryption with 96-Bit IV and 128-Bit Tag.
+   /// The GHASH of 8 ciphertext Blocks is stitched into the AES rounds of 8 counter Blocks
+   /// so that the data is read only once and both units work in parallel.
+   /// </summary>
+   template<typename TAES>
+   class GCMs : protected TAES
+   {
+   public:
+      static constexpr const size_t IVSIZE  = 12U;
+      static constexpr const size_t TAGSIZE = 16U;
+
+   protected:
+      GHASHs ghash;
+
+      /// <summary>
+      /// Creates K counter Blocks from the byte reflected counter and increments it by K.
+      /// </summary>
+      template<size_t K>
+      INLINE static void counters(__m128i* m, __m128i& ctr, const __m128i& ONE)
+      {
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+         {
+            m[j] = GHASHs::bswap(ctr);
+            ctr  = _mm_add_epi32(ctr, ONE);
+         }
+      }
+
+      /// <summary>
+      /// Encrypts K counter Blocks in m while absorbing K Blocks of ciphertext c into the GHASH state y.
+      /// </summary>
+      template<size_t K>
+      INLINE void encryptGHASH(__m128i* m, const __m128i* c, __m128i& y)
+      {
+         static_assert(K < TAES::NROUNDS);
+         __m128i lo  = _mm_setzero_si128();
+         __m128i mid = _mm_setzero_si128();
+         __m128i hi  = _mm_setzero_si128();
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_xor_si128(m[j], this->ek[0]);
+         CPPCORE_UNROLL
+         for (uint32_t i = 1U; i < TAES::NROUNDS; i++)
+         {
+            const __m128i k = this->ek[i];
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < K; j++)
+               m[j] = _mm_aesenc_si128(m[j], k);
+            if (i == 1U)
+               ghash.template mul<K>(_mm_xor_si128(GHASHs::bswap(c[0]), y), 0, lo, mid, hi);
+            else if (i <= K)
+               ghash.template mul<K>(GHASHs::bswap(c[i-1U]), i-1U, lo, mid, hi);
+         }
+         CPPCORE_UNROLL
+         for (size_t j = 0; j < K; j++)
+            m[j] = _mm_aesenclast_si128(m[j], this->ek[TAES::NROUNDS]);
+         y = GHASHs::reduce(lo, mid, hi);
+      }
+
+      /// <summary>
+      /// Builds the byte reflected counter J0 from the 96-Bit IV.
+      /// </summary>
+      INLINE static __m128i init(const void* iv)
+      {
+         __m128i j0 = _mm_loadl_epi64((const __m128i*)iv);
+         j0 = _mm_insert_epi32(j0, *(const int32_t*)((const uint8_t*)iv + 8U), 2);
+         j0 = _mm_insert_epi32(j0, 0x01000000, 3);
+         return GHASHs::bswap(j0);
+      }
+
+      /// <summary>
+      /// Absorbs the length Block and computes the Tag.
+      /// </summary>
+      INLINE __m128i finish(__m128i& y, const __m128i& j0, size_t aadlen, size_t len)
+      {
+         __m128i l = GHASHs::bswap(_mm_set_epi64x((int64_t)aadlen << 3, (int64_t)len << 3));
+         __m128i t = GHASHs::bswap(j0);
+         ghash.template update<1>(y, &l);
+         TAES::encrypt(t);
+         return _mm_xor_si128(t, GHASHs::bswap(y));
+      }
+
+   public:
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE GCMs() { }
+
+      /// <summary>
+      /// Constructor. Key size must match TAES.
+      /// </summary>
+      INLINE GCMs(const void* key) { reset(key); }
+
+      /// <summary>
+      /// Reset with new key
+      /// </summary>
+      INLINE void reset(const void* key)
+      {
+         CPPCORE_ALIGN16 __m128i h = _mm_setzero_si128();
+         TAES::reset(key, false);
+         TAES::encrypt(h);
+         ghash.reset(&h);
+      }
+
+      /// <summary>
+      /// Encrypts len Bytes from in to out and authenticates them together with aadlen Bytes of aad.
+      /// Writes the 16 Bytes Tag to tag. IV must be 12 Bytes and must never repeat for a key.
+      /// </summary>
+      INLINE void encrypt(
+         const void* iv, const void* aad, const size_t aadlen,
+         const void* in, void* out, const size_t len, void* tag)
+      {
+         const __m128i ONE = _mm_set_epi32(0,0,0,1);
+         const __m128i j0  = init(iv);
+
+         __m128i  ctr  = _mm_add_epi32(j0, ONE);
+         __m128i  y    = _mm_setzero_si128();
+         __m128i* bin  = (__m128i*)in;
+         __m128i* bout = (__m128i*)out;
+         size_t   n    = len;
+         __m128i  m[8];
+         __m128i  c[8];
+
+         ghash.update(y, aad, aadlen);
+
+         if (n >= 128U)
+         {
+            // first 8 Blocks without GHASH
+            counters<8>(m, ctr, ONE);
+            TAES::template encrypt<8>(m);
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 8U; j++)
+            {
+               c[j] = _mm_xor_si128(m[j], _mm_loadu_si128(bin + j));
+               _mm_storeu_si128(bout + j, c[j]);
+            }
+            bin  += 8U;
+            bout += 8U;
+            n    -= 128U;
+
+            // next 8 Blocks with GHASH of previous 8 Blocks
+            while (n >= 128U)
+            {
+               counters<8>(m, ctr, ONE);
+               encryptGHASH<8>(m, c, y);
+               CPPCORE_UNROLL
+               for (size_t j = 0; j < 8U; j++)
+               {
+                  c[j] = _mm_xor_si128(m[j], _mm_loadu_si128(bin + j));
+                  _mm_storeu_si128(bout + j, c[j]);
+               }
+               bin  += 8U;
+               bout += 8U;
+               n    -= 128U;
+            }
+
+            // GHASH of last 8 Blocks
+            ghash.template update<8>(y, c);
+         }
+         if (n >= 64U)
+         {
+            counters<4>(m, ctr, ONE);
+            TAES::template encrypt<4>(m);
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 4U; j++)
+            {
+               c[j] = _mm_xor_si128(m[j], _mm_loadu_si128(bin + j));
+               _mm_storeu_si128(bout + j, c[j]);
+            }
+            ghash.template update<4>(y, c);
+            bin  += 4U;
+            bout += 4U;
+            n    -= 64U;
+         }
+         while (n >= 16U)
+         {
+            counters<1>(m, ctr, ONE);
+            TAES::encrypt(m[0]);
+            c[0] = _mm_xor_si128(m[0], _mm_loadu_si128(bin++));
+            _mm_storeu_si128(bout++, c[0]);
+            ghash.template update<1>(y, c);
+            n -= 16U;
+         }
+         if (n)
+         {
+            counters<1>(m, ctr, ONE);
+            TAES::encrypt(m[0]);
+            this->xor0to15(bout, bin, m, n);
+            c[0] = _mm_setzero_si128();
+            ::memcpy(c, bout, n);
+            ghash.template update<1>(y, c);
+         }
+         _mm_storeu_si128((__m128i*)tag, finish(y, j0, aadlen, len));
+      }
+
+      /// <summary>
+      /// Decrypts len Bytes from in to out and verifies them together with aadlen Bytes of aad against tag.
+      /// Returns false and zeros out if the Tag does not match.
+      /// </summary>
+      INLINE bool decrypt(
+         const void* iv, const void* aad, const size_t aadlen,
+         const void* in, void* out, const size_t len, const void* tag)
+      {
+         const __m128i ONE = _mm_set_epi32(0,0,0,1);
+         const __m128i j0  = init(iv);
+
+         __m128i  ctr  = _mm_add_epi32(j0, ONE);
+         __m128i  y    = _mm_setzero_si128();
+         __m128i* bin  = (__m128i*)in;
+         __m128i* bout = (__m128i*)out;
+         size_t   n    = len;
+         __m128i  m[8];
+         __m128i  c[8];
+
+         ghash.update(y, aad, aadlen);
+
+         while (n >= 128U)
+         {
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 8U; j++)
+               c[j] = _mm_loadu_si128(bin + j);
+            counters<8>(m, ctr, ONE);
+            encryptGHASH<8>(m, c, y);
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 8U; j++)
+               _mm_storeu_si128(bout + j, _mm_xor_si128(m[j], c[j]));
+            bin  += 8U;
+            bout += 8U;
+            n    -= 128U;
+         }
+         if (n >= 64U)
+         {
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 4U; j++)
+               c[j] = _mm_loadu_si128(bin + j);
+            counters<4>(m, ctr, ONE);
+            encryptGHASH<4>(m, c, y);
+            CPPCORE_UNROLL
+            for (size_t j = 0; j < 4U; j++)
+               _mm_storeu_si128(bout + j, _mm_xor_si128(m[j], c[j]));
+            bin  += 4U;
+            bout += 4U;
+            n    -= 64U;
+         }
+         while (n >= 16U)
+         {
+            c[0] = _mm_loadu_si128(bin++);
+            counters<1>(m, ctr, ONE);
+            TAES::encrypt(m[0]);
+            ghash.template update<1>(y, c);
+            _mm_storeu_si128(bout++, _mm_xor_si128(m[0], c[0]));
+            n -= 16U;
+         }
+         if (n)
+         {
+            c[0] = _mm_setzero_si128();
+            ::memcpy(c, bin, n);
+            counters<1>(m, ctr, ONE);
+            TAES::encrypt(m[0]);
+            ghash.template update<1>(y, c);
+            this->xor0to15(bout, c, m, n);
+         }
+         const __m128i t = _mm_xor_si128(finish(y, j0, aadlen, len), _mm_loadu_si128((const __m128i*)tag));
+         if (!_mm_testz_si128(t, t))
+         {
+            CppCore::Memory::clear(out, len);
+            return false;
+         }
+         return true;
+      }
+   };
+
+   using AES128GCMs = GCMs<AES128s>;
+   using AES192GCMs = GCMs<AES192s>;
+   using AES256GCMs = GCMs<AES256s>;
+#endif
 #endif
    
    /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1140,4 +1953,14 @@ namespace CppCore
    using AES192 = AES192g;
    using AES256 = AES256g;
 #endif
+
+#if defined(CPPCORE_CPUFEAT_AES) && defined(CPPCORE_CPUFEAT_SSE41) && defined(CPPCORE_CPUFEAT_PCLMUL)
+   using AES128GCM = AES128GCMs;
+   using AES192GCM = AES192GCMs;
+   using AES256GCM = AES256GCMs;
+#else
+   using AES128GCM = GCMg<AES128>;
+   using AES192GCM = GCMg<AES192>;
+   using AES256GCM = GCMg<AES256>;
+#endif
 }
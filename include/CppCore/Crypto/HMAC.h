@@ -7,7 +7,10 @@
 namespace CppCore
 {
    /// <summary>
-   /// Keyed-Hash Message Authentication Code
+   /// Keyed-Hash Message Authentication Code.
+   /// Keeps snapshots of the hash states after absorbing the inner and outer key blocks,
+   /// so restart() and finish() don't need to hash the padded key again.
+   /// Copying an instance clones the keyed snapshots.
    /// </summary>
    template<typename THASH>
    class HMAC
@@ -21,8 +24,9 @@ namespace CppCore
       using Digest = typename THASH::Digest;
 
    protected:
-      Hash  hsh;
-      Block pad;
+      Hash hsh;  // current state
+      Hash ihsh; // state after in padding^key
+      Hash ohsh; // state after out padding^key
 
    public:
       /// <summary>
@@ -39,27 +43,41 @@ namespace CppCore
          const uint8_t outpad = OUTPAD)
       {
          Digest b;
-
-         hsh.reset();
+         Block  pad;
 
          // use hash of key if too large
          if (len > sizeof(pad))
          {
+            hsh.reset();
             hsh.step(key, len);
             hsh.finish(b);
-            hsh.reset();
             key = &b;
             len = sizeof(b);
          }
 
-         // step on in padding^key
+         // snapshot after in padding^key
          pad.set(inpad);
          pad.xor_(key, len);
-         hsh.step(pad);
+         ihsh.reset();
+         ihsh.step(pad);
 
-         // prepare out padding^key
+         // snapshot after out padding^key
          pad.set(outpad);
          pad.xor_(key, len);
+         ohsh.reset();
+         ohsh.step(pad);
+
+         // start from inner snapshot
+         hsh = ihsh;
+      }
+
+      /// <summary>
+      /// Restarts the HMAC calculation with the key of the last reset().
+      /// Only restores the inner snapshot and does not hash the key again.
+      /// </summary>
+      INLINE void restart()
+      {
+         hsh = ihsh;
       }
 
       /// <summary>
@@ -90,24 +108,24 @@ namespace CppCore
 
       /// <summary>
       /// Finish HMAC calculation into digest.
+      /// Call restart() or reset() before the next calculation.
       /// </summary>
       INLINE void finish(Digest& digest)
       {
          hsh.finish(digest);
-         hsh.reset();
-         hsh.step(pad);
+         hsh = ohsh;
          hsh.step(digest);
          hsh.finish(digest);
       }
 
       /// <summary>
       /// Finish HMAC calculation into digest.
+      /// Call restart() or reset() before the next calculation.
       /// </summary>
       INLINE void finish(void* digest)
       {
          hsh.finish(digest);
-         hsh.reset();
-         hsh.step(pad);
+         hsh = ohsh;
          hsh.step(digest, sizeof(Digest));
          hsh.finish(digest);
       }
@@ -2,6 +2,14 @@
 
 #include <CppCore/Root.h>
 #include <CppCore/Crypto/HMAC.h>
+#ifndef CPPCORE_NO_THREADING
+#include <CppCore/Threading/Handler.h>
+#endif
+
+#ifndef CPPCORE_PBKDF2_MAXBLOCKS
+// Max. output blocks PBKDF2 computes concurrently on a pool, longer outputs are done in rounds
+#define CPPCORE_PBKDF2_MAXBLOCKS 8
+#endif
 
 namespace CppCore
 {
@@ -14,6 +22,34 @@ namespace CppCore
    protected:
       HMAC hmac;
 
+      /// <summary>
+      /// Computes output block idx (starting at 1) into mdx using the keyed hmac.
+      /// Works on a copy of the keyed snapshots, so blocks can be computed concurrently.
+      /// </summary>
+      INLINE void block(
+         const void* salt, const size_t lensalt, 
+         const size_t iterations, const uint32_t idx, 
+         typename HMAC::Digest& mdx) const
+      {
+         typename HMAC::Digest md1;
+
+         HMAC h(hmac);
+         const uint32_t ctrbe = CppCore::byteswap32(idx);
+         h.step(salt, lensalt);
+         h.step(&ctrbe, 4);
+         h.finish(md1);
+
+         CppCore::clone(mdx, md1);
+
+         for (size_t i = 1; i < iterations; i++)
+         {
+            h.restart();
+            h.step(md1);
+            h.finish(md1);
+            mdx ^= md1;
+         }
+      }
+
    public:
       /// <summary>
       /// Constructor
@@ -29,30 +65,16 @@ namespace CppCore
          const size_t iterations, 
          void* digest, size_t lendigest)
       {
-         typename HMAC::Digest md1;
          typename HMAC::Digest mdx;
 
          uint8_t* pdigest = (uint8_t*)digest;
          uint32_t ctrle = 1U;
-         uint32_t ctrbe;
+
+         hmac.reset(pw, lenpw);
 
          while (lendigest)
          {
-            ctrbe = CppCore::byteswap32(ctrle);
-            hmac.reset(pw, lenpw);
-            hmac.step(salt, lensalt);
-            hmac.step(&ctrbe, 4);
-            hmac.finish(md1);
-
-            CppCore::clone(mdx, md1);
-
-            for (size_t i = 1; i < iterations; i++)
-            {
-               hmac.reset(pw, lenpw);
-               hmac.step(md1);
-               hmac.finish(md1);
-               mdx ^= md1;
-            }
+            block(salt, lensalt, iterations, ctrle, mdx);
 
             const size_t min = MIN(lendigest, sizeof(mdx));
             Memory::copy(pdigest, &mdx, min);
@@ -61,6 +83,144 @@ namespace CppCore
             ctrle++;
          }
       }
+
+   #ifndef CPPCORE_NO_THREADING
+      /// <summary>
+      /// Created digest using pw, salt and iterations.
+      /// If more than one output block is required, the additional blocks
+      /// are offered to the given pool in rounds of up to CPPCORE_PBKDF2_MAXBLOCKS.
+      /// The calling thread computes the first block of a round and then
+      /// any block no pool thread has picked up yet, so it also completes
+      /// if called from the only thread of the pool.
+      /// </summary>
+      INLINE void create(
+         const void* pw,   const size_t lenpw, 
+         const void* salt, const size_t lensalt, 
+         const size_t iterations, 
+         void* digest, size_t lendigest,
+         Handler& pool)
+      {
+         constexpr size_t MAXBLOCKS = CPPCORE_PBKDF2_MAXBLOCKS;
+         static_assert(MAXBLOCKS > 1U, "CPPCORE_PBKDF2_MAXBLOCKS must be at least 2");
+
+         // blocks of a round shared with the runnables,
+         // each block is computed by whoever claims it first
+         struct Round
+         {
+            const PBKDF2*      self;
+            const void*        salt;
+            size_t             lensalt;
+            size_t             iterations;
+            uint32_t           first;
+            size_t             done;
+            mutex              mtx;
+            condition_variable cv;
+            atomic<bool>       claimed[MAXBLOCKS];
+            typename HMAC::Digest md[MAXBLOCKS];
+
+            INLINE bool claim(const size_t i) { return !claimed[i].exchange(true); }
+            INLINE void compute(const size_t i)
+            {
+               self->block(salt, lensalt, iterations, first + (uint32_t)i, md[i]);
+            }
+         };
+
+         const size_t n = (lendigest + sizeof(typename HMAC::Digest) - 1U) / sizeof(typename HMAC::Digest);
+
+         // single block
+         if (n <= 1U)
+         {
+            create(pw, lenpw, salt, lensalt, iterations, digest, lendigest);
+            return;
+         }
+
+         Round round;
+         Runnable run[MAXBLOCKS - 1U];
+         uint8_t* pdigest = (uint8_t*)digest;
+
+         round.self       = this;
+         round.salt       = salt;
+         round.lensalt    = lensalt;
+         round.iterations = iterations;
+         round.first      = 1U;
+
+         // block i of a round when run by the pool, skipped if already claimed
+         for (size_t i = 1U; i < MAXBLOCKS; i++)
+         {
+            run[i - 1U].setFunction([&round, i]()
+            {
+               if (round.claim(i))
+               {
+                  round.compute(i);
+                  unique_lock<mutex> l(round.mtx);
+                  round.done++;
+                  round.cv.notify_one();
+               }
+            });
+         }
+
+         hmac.reset(pw, lenpw);
+
+         while (lendigest)
+         {
+            const size_t k = MIN(n - (round.first - 1U), MAXBLOCKS);
+
+            for (size_t i = 0U; i < k; i++)
+               round.claimed[i] = false;
+            round.done = 0U;
+
+            // offer blocks 2..k of this round to the pool
+            for (size_t i = 1U; i < k; i++)
+               pool.schedule(run[i - 1U]);
+
+            // first block and all not yet picked up on this thread
+            size_t own = 0U;
+            for (size_t i = 0U; i < k; i++)
+            {
+               if (round.claim(i))
+               {
+                  round.compute(i);
+                  own++;
+               }
+            }
+
+            // remove the ones still queued, they have nothing left to do
+            for (size_t i = 1U; i < k; i++)
+               pool.cancel(run[i - 1U]);
+
+            // wait for the blocks computed on the pool
+            unique_lock<mutex> l(round.mtx);
+            round.cv.wait(l, [&round, k, own]() { return round.done == k - own; });
+            l.unlock();
+
+            // runnables must be idle before reuse or return,
+            // left is only what the pool does after their function returned
+            for (size_t i = 1U; i < k; i++)
+            {
+               Runnable& r = run[i - 1U];
+               for (;;)
+               {
+                  r.lock();
+                  const bool idle = r.isIdle();
+                  r.unlock();
+                  if (idle)
+                     break;
+                  ::std::this_thread::yield();
+               }
+            }
+
+            // copy the output of this round
+            for (size_t i = 0U; i < k && lendigest; i++)
+            {
+               const size_t min = MIN(lendigest, sizeof(typename HMAC::Digest));
+               Memory::copy(pdigest, &round.md[i], min);
+               lendigest -= min;
+               pdigest += min;
+            }
+            round.first += (uint32_t)k;
+         }
+      }
+   #endif
    };
 
    /// <summary>
@@ -1,5 +1,10 @@
 #pragma once
 
+#ifndef CPPCORE_BASEX_DC_THRESHOLD
+// Min. 64-Bit limbs for divide and conquer radix conversion in BaseX::tostring(), chunked below
+#define CPPCORE_BASEX_DC_THRESHOLD 16
+#endif
+
 #include <CppCore/Root.h>
 #include <CppCore/Math/Util.h>
 #include <CppCore/Memory.h>
@@ -132,6 +137,22 @@ namespace CppCore
       return LOOKUP_XDIGIT[(uint8_t)c];
    }
 
+   /// <summary>
+   /// Lookup Table for two decimal digits.
+   /// Contains the two symbols of 00 to 99 at index 2*i.
+   /// </summary>
+   CPPCORE_ALIGN64 static constexpr char LOOKUP_DIGITS2[] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
    // BASEX
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +164,293 @@ namespace CppCore
    {
    private:
       INLINE BaseX() { }
+
+      /// <summary>
+      /// Largest power d=base^k with k symbols that is not larger than max.
+      /// </summary>
+      struct Chunk
+      {
+         uint64_t    d;
+         uint32_t    k;
+         uint32_t    base;
+         const char* alphabet;
+         bool        decimal;
+         INLINE Chunk(const uint32_t base, const char* alphabet, const uint64_t max) :
+            d(base), k(1U), base(base), alphabet(alphabet),
+            decimal(base == 10U && ::memcmp(alphabet, CPPCORE_ALPHABET_B10, 10U) == 0)
+         {
+            while (d <= max / base) { d *= base; k++; }
+         }
+      };
+
+      /// <summary>
+      /// Limbs of divide and conquer conversion
+      /// </summary>
+      template<size_t L>
+      struct Limbs { uint64_t x[L]; };
+
+      /// <summary>
+      /// Writes the symbols of v backwards ending before s and returns the first symbol.
+      /// Writes exactly c.k symbols if pad is true, else no leading zero symbols.
+      /// Uses LOOKUP_DIGITS2 for the decimal alphabet.
+      /// </summary>
+      INLINE static char* tostringchunk(uint64_t v, char* s, const Chunk& c, const bool pad)
+      {
+         char* end = pad ? s - c.k : s;
+         if (c.decimal)
+         {
+            while (v >= 100U)
+            {
+               const uint64_t q = v / 100U;
+               s -= 2;
+               ::memcpy(s, &LOOKUP_DIGITS2[(v - q * 100U) * 2U], 2U);
+               v = q;
+            }
+            if (v >= 10U)
+            {
+               s -= 2;
+               ::memcpy(s, &LOOKUP_DIGITS2[v * 2U], 2U);
+            }
+            else
+               *--s = (char)('0' + v);
+         }
+         else
+         {
+            do
+            {
+               const uint64_t q = v / c.base;
+               *--s = c.alphabet[v - q * c.base];
+               v = q;
+            } while (v);
+         }
+         while (s > end)
+            *--s = c.alphabet[0];
+         return s;
+      }
+
+      /// <summary>
+      /// Chunked conversion of n 32-Bit or 64-Bit limbs in x, which are destroyed.
+      /// Divides by c.d per chunk and skips leading zero limbs.
+      /// Writes the symbols backwards ending before s and returns the first symbol.
+      /// Writes at least pad symbols, padded with the zero symbol.
+      /// </summary>
+      template<typename T>
+      INLINE static char* tostringx(T* x, uint32_t n, char* s, const Chunk& c, const size_t pad)
+      {
+         char* end = s - pad;
+         while (n && !x[n-1U])
+            n--;
+         do
+         {
+            T r = 0U;
+            for (uint32_t i = n-1U; i != UINT32_MAX; i--)
+            {
+            #if defined(CPPCORE_CPU_X64)
+               if constexpr (sizeof(T) == 8U)
+                  CppCore::udivmod128_64(r, x[i], c.d, x[i], r);
+               else
+            #endif
+                  CppCore::udivmod64_32(r, x[i], (T)c.d, x[i], r);
+            }
+            while (n && !x[n-1U])
+               n--;
+            s = BaseX::tostringchunk(r, s, c, n != 0U);
+         } while (n);
+         while (s > end)
+            *--s = c.alphabet[0];
+         return s;
+      }
+
+   #if defined(CPPCORE_CPU_X64)
+      /// <summary>
+      /// Calculates p[L-1]=c.d^L for all powers of two up to L, each stored in L limbs at index L-1.
+      /// </summary>
+      template<size_t L>
+      INLINE static void tostringpow(uint64_t* p, const uint64_t d)
+      {
+         if constexpr (L == 1U)
+            p[0] = d;
+         else
+         {
+            constexpr size_t H = L / 2U;
+            BaseX::tostringpow<H>(p, d);
+            CppCore::usquare(*(const Limbs<H>*)&p[H-1U], *(Limbs<L>*)&p[L-1U]);
+         }
+      }
+
+      /// <summary>
+      /// Divide and conquer conversion of x less than c.d^L, which is destroyed.
+      /// Splits by the precomputed power c.d^(L/2) from tostringpow() and converts the halves.
+      /// Writes the symbols backwards ending before s and returns the first symbol.
+      /// Writes exactly L*c.k symbols if pad is true, else no leading zero symbols.
+      /// </summary>
+      template<size_t L>
+      INLINE static char* tostringdc(Limbs<L>& x, char* s, const Chunk& c, const uint64_t* p, const bool pad)
+      {
+         if constexpr (L < CPPCORE_BASEX_DC_THRESHOLD || L < 2U)
+            return BaseX::tostringx(x.x, (uint32_t)L, s, c, pad ? L * c.k : 0U);
+         else
+         {
+            // x < d^L and so q,r < d^(L/2) and both fit into L/2 limbs
+            constexpr size_t H = L / 2U;
+            CPPCORE_ALIGN_OPTIM(Limbs<L>) q;
+            CPPCORE_ALIGN_OPTIM(Limbs<H>) r;
+            CPPCORE_ALIGN_OPTIM(Limbs<L>) mem[2];
+            CppCore::udivmod(q, r, x, *(const Limbs<H>*)&p[H-1U], mem);
+            if (!pad && CppCore::testzero(q))
+               return BaseX::tostringdc<H>(r, s, c, p, false);
+            s = BaseX::tostringdc<H>(r, s, c, p, true);
+            return BaseX::tostringdc<H>(*(Limbs<H>*)&q, s, c, p, pad);
+         }
+      }
+   #endif
+
+      /// <summary>
+      /// Encodes unsigned integer v backwards ending before s and returns the first symbol.
+      /// Requires sizeof(UINT)*8 free bytes before s.
+      /// </summary>
+      template<typename UINT>
+      INLINE static char* tostringr(const UINT& val, char* s, const uint32_t base, const char* alphabet)
+      {
+         if constexpr (sizeof(UINT) <= 8U)
+         {
+            // native, single chunk
+            uint64_t v = 0ULL;
+            ::memcpy(&v, &val, sizeof(UINT));
+            return BaseX::tostringchunk(v, s, Chunk(base, alphabet, UINT64_MAX), false);
+         }
+      #if defined(CPPCORE_CPU_X64)
+         else if constexpr (sizeof(UINT) % 8U == 0U)
+         {
+            constexpr size_t M = sizeof(UINT) / 8U;
+            const Chunk c(base, alphabet, UINT64_MAX);
+            CPPCORE_ALIGN_OPTIM(Limbs<M>) x;
+            ::memcpy(&x, &val, sizeof(UINT));
+            if constexpr (M >= CPPCORE_BASEX_DC_THRESHOLD && (M & (M-1U)) == 0U)
+            {
+               // x=q*d^M+r with r < d^M converted by divide and conquer and small q chunked
+               CPPCORE_ALIGN_OPTIM(Limbs<M>) q;
+               CPPCORE_ALIGN_OPTIM(Limbs<M>) r;
+               CPPCORE_ALIGN_OPTIM(Limbs<M>) mem[2];
+               uint64_t p[M+M];
+               BaseX::tostringpow<M>(p, c.d);
+               CppCore::udivmod(q, r, x, *(const Limbs<M>*)&p[M-1U], mem);
+               if (CppCore::testzero(q))
+                  return BaseX::tostringdc<M>(r, s, c, p, false);
+               s = BaseX::tostringdc<M>(r, s, c, p, true);
+               return BaseX::tostringx(q.x, (uint32_t)M, s, c, 0U);
+            }
+            else
+               return BaseX::tostringx(x.x, (uint32_t)M, s, c, 0U);
+         }
+      #endif
+         else
+         {
+            static_assert(sizeof(UINT) % 4U == 0U);
+            uint32_t x[sizeof(UINT) / 4U];
+            ::memcpy(x, &val, sizeof(UINT));
+            return BaseX::tostringx(x, (uint32_t)(sizeof(UINT) / 4U), s, Chunk(base, alphabet, UINT32_MAX), 0U);
+         }
+      }
+
+      /// <summary>
+      /// True if all eight bytes of v are decimal digits '0' to '9'.
+      /// </summary>
+      INLINE static bool isdigits8(const uint64_t v)
+      {
+         return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL;
+      }
+
+      /// <summary>
+      /// Value of eight decimal digits loaded little endian into v, first digit is most significant.
+      /// </summary>
+      INLINE static uint64_t parsedigits8(uint64_t v)
+      {
+         v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561U) >> 8;
+         v = ((v & 0x00FF00FF00FF00FFULL) * 6553601U) >> 16;
+         return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+      }
+
+      /// <summary>
+      /// Folds m symbols from p into v and advances p.
+      /// Uses SWAR for eight symbols at once with the decimal alphabet.
+      /// Returns false on invalid symbol if CHECK is true.
+      /// </summary>
+      template<bool CHECK>
+      INLINE static bool parsechunk(const char*& p, uint32_t m, size_t& v, const uint8_t* tbl, const Chunk& c)
+      {
+         static_assert(CPPCORE_ENDIANESS_LITTLE);
+         v = 0U;
+         if (c.decimal)
+         {
+            while (m >= 8U)
+            {
+               uint64_t t;
+               ::memcpy(&t, p, 8U);
+               if constexpr (CHECK)
+                  if (!BaseX::isdigits8(t)) CPPCORE_UNLIKELY
+                     return false;
+               v = v * 100000000U + (size_t)BaseX::parsedigits8(t);
+               p += 8U;
+               m -= 8U;
+            }
+         }
+         while (m)
+         {
+            const uint8_t idx = tbl[(uint8_t)*p++];
+            if constexpr (CHECK)
+               if (idx == 0xFFU) CPPCORE_UNLIKELY
+                  return false;
+            v = v * c.base + idx;
+            m--;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// Parses n symbols by single multiply and add of c.d per chunk of c.k symbols.
+      /// The first chunk takes the remaining n mod c.k symbols.
+      /// Returns false on invalid symbol or overflow if CHECK is true.
+      /// </summary>
+      template<typename UINT, bool CHECK>
+      INLINE static bool parsex(const char* p, size_t n, UINT& r, const uint8_t* tbl, const Chunk& c)
+      {
+         size_t v;
+         uint32_t m = (uint32_t)(n % c.k);
+         if (m == 0U)
+            m = c.k;
+         CppCore::clear(r);
+         if (!BaseX::parsechunk<CHECK>(p, m, v, tbl, c)) CPPCORE_UNLIKELY
+            return false;
+         ::memcpy((void*)&r, &v, sizeof(size_t));
+         n -= m;
+         while (n)
+         {
+            if (!BaseX::parsechunk<CHECK>(p, c.k, v, tbl, c)) CPPCORE_UNLIKELY
+               return false;
+            if constexpr (CHECK)
+            {
+               CppCore::Padded<UINT> t;
+               CppCore::umul(r, (size_t)c.d, t);
+               if (!CppCore::testzero(t.t)) CPPCORE_UNLIKELY
+                  return false; // mul overflow
+               uint8_t carry = 0;
+               CppCore::addcarry(t.v, v, r, carry);
+               if (carry != 0) CPPCORE_UNLIKELY
+                  return false; // add overflow
+            }
+            else
+            {
+               CppCore::umul(r, (size_t)c.d, r);
+               CppCore::uadd(r, v, r);
+            }
+            n -= c.k;
+         }
+         return true;
+      }
+
    public:
       /// <summary>
       /// Returns an upper bound of decoded bits required for encoded symbols.
@@ -170,28 +478,28 @@ namespace CppCore
 
       /// <summary>
       /// Encodes unsigned integer v into string s using alphabet.
+      /// Converts chunks of as many symbols as fit into a 64-Bit limb per division
+      /// and splits large integers by divide and conquer.
       /// </summary>
       template<typename UINT>
       INLINE static intptr_t tostring(const UINT& val, char* s, intptr_t len, const uint32_t base, const char* alphabet, bool writeterm)
       {
          assert(base >= 2U);
          assert(::strlen(alphabet) == base);
-         CPPCORE_ALIGN_OPTIM(UINT) v;
-         uint32_t r;
-         uint32_t n = 0U;
-         bool     z;
-         CppCore::clone(v, val);
-         do
+         char  buf[sizeof(UINT)*8U];
+         char* end   = buf + sizeof(buf);
+         char* start = BaseX::tostringr(val, end, base, alphabet);
+         const intptr_t n = end - start;
+         if (n <= len)
          {
-            z = CppCore::udivmod_testzero(v, base, v, r);
-            if (len > 0) *s++ = alphabet[r];
-            n++; len--;
-         } while (!z);
-         if (len >= 0)
-            Memory::reverse(s-n, n);
+            ::memcpy(s, start, n);
+            s += n;
+         }
+         else if (len > 0)
+            s += len;
          if (writeterm)
             *s = (char)0x00;
-         return len;
+         return len - n;
       }
 
       /// <summary>
@@ -203,18 +511,10 @@ namespace CppCore
       {
          assert(base >= 2U);
          assert(::strlen(alphabet) == base);
-         CPPCORE_ALIGN_OPTIM(UINT) v;
-         uint32_t r;
-         uint32_t n = 0U;
-         bool     z;
-         CppCore::clone(v, val);
-         do
-         {
-            z = CppCore::udivmod_testzero(v, base, v, r);
-            s += alphabet[r];
-            n++;
-         } while (!z);
-         Memory::reverse(s.data()+s.length()-n, n);
+         char  buf[sizeof(UINT)*8U];
+         char* end   = buf + sizeof(buf);
+         char* start = BaseX::tostringr(val, end, base, alphabet);
+         s.append(start, end - start);
       }
 
       /// <summary>
@@ -236,20 +536,22 @@ namespace CppCore
       INLINE static void parse(const char* input, UINT& r, const char* alphabet)
       {
          assert(::strlen(alphabet) >= 2);
-         uint8_t n = 0;
-         CPPCORE_ALIGN64 uint8_t tbl[256];
-         CppCore::clear(tbl);
-         CppCore::clear(r);
-         while (const char c = *alphabet++)
-            tbl[c] = n++;
-         if (const char c = *input++)
+         if constexpr (sizeof(UINT) < sizeof(size_t))
          {
-            *(uint8_t*)&r = tbl[c];
-            while (const char c = *input++)
-            {
-               CppCore::umul(r, n, r);
-               CppCore::uadd(r, tbl[c], r);
-            }
+            size_t t;
+            BaseX::parse(input, t, alphabet);
+            r = (UINT)t;
+         }
+         else
+         {
+            uint8_t n = 0;
+            CPPCORE_ALIGN64 uint8_t tbl[256];
+            CppCore::clear(tbl);
+            CppCore::clear(r);
+            for (const char* a = alphabet; const char c = *a; a++)
+               tbl[(uint8_t)c] = n++;
+            if (const size_t len = ::strlen(input))
+               BaseX::parsex<UINT, false>(input, len, r, tbl, Chunk(n, alphabet, SIZE_MAX));
          }
       }
 
@@ -262,38 +564,28 @@ namespace CppCore
       {
          if (!input || !alphabet)
             return false; // null pointer
-         uint8_t n = 0;
-         CPPCORE_ALIGN64 uint8_t tbl[256];
-         CppCore::bytedup(0xFF, tbl);
-         while (const char c = *alphabet++)
-            tbl[c] = n++;
-         if (n < 2U) CPPCORE_UNLIKELY
-            return false; // alphabet too short
-         if (const char first = *input++) CPPCORE_LIKELY
+         if constexpr (sizeof(UINT) < sizeof(size_t))
          {
-            CppCore::clear(r);
-            uint8_t idx = tbl[first];
-            if (idx == 0xFF) CPPCORE_UNLIKELY
-               return false; // invalid first symbol
-            *(uint8_t*)&r = idx;
-            while (const char c = *input++)
-            {
-               CppCore::Padded<UINT> t;
-               idx = tbl[c];
-               if (idx == 0xFFU) CPPCORE_UNLIKELY
-                  return false; // invalid symbol
-               CppCore::umul(r, n, t);
-               if (!CppCore::testzero(t.t)) CPPCORE_UNLIKELY
-                  return false; // mul overflow
-               uint8_t carry = 0;
-               CppCore::addcarry(t.v, idx, r, carry);
-               if (carry != 0) CPPCORE_UNLIKELY
-                  return false; // add overflow
-            }
+            size_t t;
+            if (!BaseX::tryparse(input, t, alphabet) || t > (size_t)(UINT)~(UINT)0) CPPCORE_UNLIKELY
+               return false; // also overflow of UINT
+            r = (UINT)t;
             return true;
          }
-         else CPPCORE_UNLIKELY
-            return false; // empty input
+         else
+         {
+            uint8_t n = 0;
+            CPPCORE_ALIGN64 uint8_t tbl[256];
+            CppCore::bytedup(0xFF, tbl);
+            for (const char* a = alphabet; const char c = *a; a++)
+               tbl[(uint8_t)c] = n++;
+            if (n < 2U) CPPCORE_UNLIKELY
+               return false; // alphabet too short
+            if (const size_t len = ::strlen(input)) CPPCORE_LIKELY
+               return BaseX::parsex<UINT, true>(input, len, r, tbl, Chunk(n, alphabet, SIZE_MAX));
+            else CPPCORE_UNLIKELY
+               return false; // empty input
+         }
       }
    };
 
@@ -744,6 +1036,84 @@ namespace CppCore
             Base64::BINTOB64_URL :
             Base64::BINTOB64_STD;
          const uint8_t* p = (const uint8_t*)in;
+      #if defined(CPPCORE_CPUFEAT_AVX512VBMI) && defined(CPPCORE_CPUFEAT_AVX512BW)
+         if (len >= 48U)
+         {
+            // 64 symbols from 48 bytes
+            // adapted from: https://github.com/WojciechMula/base64simd
+            // vpermb spreads 3 bytes to 4, vpmultishiftqb extracts the 6-bit indices
+            const __m512i LUT  = _mm512_loadu_si512((const __m512i*)tbl);
+            const __m512i SHUF = _mm512_setr_epi32(
+               0x01020001, 0x04050304, 0x07080607, 0x0a0b090a,
+               0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+               0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122,
+               0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e);
+            const __m512i SHIFTS = _mm512_set1_epi64(0x3036242a1016040a);
+            do
+            {
+               __m512i t = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFFULL, p);
+               t = _mm512_permutexvar_epi8(SHUF, t);
+               t = _mm512_multishift_epi64_epi8(SHIFTS, t);
+               t = _mm512_permutexvar_epi8(t, LUT);
+               _mm512_storeu_si512((__m512i*)out, t);
+               p   += 48;
+               len -= 48;
+               out += 64;
+            } while (len >= 48U);
+         }
+      #endif
+      #if defined(CPPCORE_CPUFEAT_AVX2)
+         if (len >= 32U)
+         {
+            // 32 symbols from 24 bytes
+            // same as SSSE3 below but with 12 bytes in each 128-bit lane
+            const __m256i SHUF1 = _mm256_set_epi8(
+               10, 11, 9, 10, 7,  8, 6,  7, 4,  5, 3,  4, 1,  2, 0,  1,
+               10, 11, 9, 10, 7,  8, 6,  7, 4,  5, 3,  4, 1,  2, 0,  1
+            );
+            const __m256i SHUF2_URL = _mm256_setr_epi8(
+               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62,
+               '_' - 63, 'A', 0, 0,
+               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62,
+               '_' - 63, 'A', 0, 0);
+            const __m256i SHUF2_STD = _mm256_setr_epi8(
+               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+               '/' - 63, 'A', 0, 0,
+               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+               '/' - 63, 'A', 0, 0);
+            const __m256i SHUF2 = url ? SHUF2_URL : SHUF2_STD;
+            const __m256i M1 = _mm256_set1_epi32(0x0fc0fc00);
+            const __m256i M2 = _mm256_set1_epi32(0x04000040);
+            const __m256i M3 = _mm256_set1_epi32(0x003f03f0);
+            const __m256i M4 = _mm256_set1_epi32(0x01000010);
+            const __m256i M5 = _mm256_set1_epi8(51);
+            const __m256i M6 = _mm256_set1_epi8(26);
+            const __m256i M7 = _mm256_set1_epi8(13);
+            do
+            {
+               __m256i t, r;
+               t = _mm256_inserti128_si256(
+                  _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)p)),
+                  _mm_loadu_si128((const __m128i*)(p+12U)), 1);
+               t = _mm256_shuffle_epi8(t, SHUF1);
+               t = _mm256_or_si256(
+                 _mm256_mulhi_epu16(_mm256_and_si256(t, M1), M2),
+                 _mm256_mullo_epi16(_mm256_and_si256(t, M3), M4));
+               r = _mm256_subs_epu8(t, M5);
+               r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(M6, t), M7));
+               r = _mm256_shuffle_epi8(SHUF2, r);
+               r = _mm256_add_epi8(r, t);
+               _mm256_storeu_si256((__m256i*)out, r);
+               p   += 24;
+               len -= 24;
+               out += 32;
+            } while (len >= 32U);
+         }
+      #endif
       #if defined(CPPCORE_CPUFEAT_SSSE3)
          if (len >= 32U)
          {
@@ -1028,6 +1398,120 @@ namespace CppCore
          const uint8_t* tbl = url ? 
             Base64::B64TOBIN_URL : 
             Base64::B64TOBIN_STD;
+      #if defined(CPPCORE_CPUFEAT_AVX512VBMI) && defined(CPPCORE_CPUFEAT_AVX512BW)
+         if (len >= 64U)
+         {
+            // 48 bytes from 64 symbols
+            // adapted from: https://github.com/WojciechMula/base64simd
+            // vpermi2b looks up all 128 ascii symbols in the scalar table,
+            // invalid ones and any non-ascii input have the high bit set.
+            // an invalid block is left to the scalar loop below.
+            const __m512i LUT0 = _mm512_loadu_si512((const __m512i*)tbl);
+            const __m512i LUT1 = _mm512_loadu_si512((const __m512i*)(tbl+64));
+            const __m512i M1   = _mm512_set1_epi32(0x01400140);
+            const __m512i M2   = _mm512_set1_epi32(0x00011000);
+            const __m512i PACK = _mm512_setr_epi32(
+               0x06000102, 0x090a0405, 0x0c0d0e08, 0x16101112,
+               0x191a1415, 0x1c1d1e18, 0x26202122, 0x292a2425,
+               0x2c2d2e28, 0x36303132, 0x393a3435, 0x3c3d3e38,
+               0x00000000, 0x00000000, 0x00000000, 0x00000000);
+            do
+            {
+               const __m512i s = _mm512_loadu_si512((const __m512i*)in);
+               __m512i v = _mm512_permutex2var_epi8(LUT0, s, LUT1);
+               if (_mm512_movepi8_mask(_mm512_or_si512(v, s)) != 0) CPPCORE_UNLIKELY
+                  break;
+               v = _mm512_maddubs_epi16(v, M1);
+               v = _mm512_madd_epi16(v, M2);
+               v = _mm512_permutexvar_epi8(PACK, v);
+               _mm512_mask_storeu_epi8(p, 0x0000FFFFFFFFFFFFULL, v);
+               p   += 48;
+               len -= 64;
+               in  += 64;
+            } while (len >= 64U);
+         }
+      #endif
+      #if defined(CPPCORE_CPUFEAT_AVX2)
+         if (len >= 32U)
+         {
+            // 24 bytes from 32 symbols
+            // adapted from: https://github.com/WojciechMula/base64simd
+            // a symbol is invalid if the class of its high nibble (LUTHI)
+            // is among the invalid classes of its low nibble (LUTLO).
+            // the offset to add is selected by the high nibble (LUTROLL),
+            // the one symbol sharing its high nibble with others (C2) is
+            // redirected to an unused slot by adding ROLLADJ to its index.
+            // an invalid block is left to the scalar loop below.
+            const __m256i LUTLO_STD = _mm256_setr_epi8(
+               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+               0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+               0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+            const __m256i LUTHI_STD = _mm256_setr_epi8(
+               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+            const __m256i LUTROLL_STD = _mm256_setr_epi8(
+               0,   16,  19,   4, -65, -65, -71, -71,
+               0,    0,   0,   0,   0,   0,   0,   0,
+               0,   16,  19,   4, -65, -65, -71, -71,
+               0,    0,   0,   0,   0,   0,   0,   0);
+            const __m256i LUTLO_URL = _mm256_setr_epi8(
+               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+               0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33,
+               0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+               0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33);
+            const __m256i LUTHI_URL = _mm256_setr_epi8(
+               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+               0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+            const __m256i LUTROLL_URL = _mm256_setr_epi8(
+               0,  -32,  17,   4, -65, -65, -71, -71,
+               0,    0,   0,   0,   0,   0,   0,   0,
+               0,  -32,  17,   4, -65, -65, -71, -71,
+               0,    0,   0,   0,   0,   0,   0,   0);
+            const __m256i LUTLO   = url ? LUTLO_URL   : LUTLO_STD;
+            const __m256i LUTHI   = url ? LUTHI_URL   : LUTHI_STD;
+            const __m256i LUTROLL = url ? LUTROLL_URL : LUTROLL_STD;
+            const __m256i C2      = url ? _mm256_set1_epi8('_') : _mm256_set1_epi8('/');
+            const __m256i ROLLADJ = url ? _mm256_set1_epi8(-4)  : _mm256_set1_epi8(-1);
+            const __m256i NIBBLE  = _mm256_set1_epi8(0x0F);
+            const __m256i M1 = _mm256_set1_epi32(0x01400140);
+            const __m256i M2 = _mm256_set1_epi32(0x00011000);
+            const __m256i SHUF = _mm256_setr_epi8(
+               2,  1,  0,  6,  5,  4,
+              10,  9,  8, 14, 13, 12,
+              -1, -1, -1, -1,
+               2,  1,  0,  6,  5,  4,
+              10,  9,  8, 14, 13, 12,
+              -1, -1, -1, -1);
+            const __m256i PACK = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+            do
+            {
+               __m256i v = _mm256_loadu_si256((const __m256i*)in);
+               const __m256i hi = _mm256_and_si256(_mm256_srli_epi32(v, 4), NIBBLE);
+               const __m256i lo = _mm256_and_si256(v, NIBBLE);
+               if (!_mm256_testz_si256(
+                  _mm256_shuffle_epi8(LUTLO, lo),
+                  _mm256_shuffle_epi8(LUTHI, hi))) CPPCORE_UNLIKELY
+                  break;
+               const __m256i idx = _mm256_add_epi8(hi,
+                  _mm256_and_si256(_mm256_cmpeq_epi8(v, C2), ROLLADJ));
+               v = _mm256_add_epi8(v, _mm256_shuffle_epi8(LUTROLL, idx));
+               v = _mm256_maddubs_epi16(v, M1);
+               v = _mm256_madd_epi16(v, M2);
+               v = _mm256_shuffle_epi8(v, SHUF);
+               v = _mm256_permutevar8x32_epi32(v, PACK);
+               _mm_storeu_si128((__m128i*)p, _mm256_castsi256_si128(v));
+               _mm_storeu_si64((__m128i*)(p+16U), _mm256_extracti128_si256(v, 1));
+               p   += 24;
+               len -= 32;
+               in  += 32;
+            } while (len >= 32U);
+         }
+      #endif
       #if defined(CPPCORE_CPUFEAT_SSSE3)
          if (len >= 32U)
          {
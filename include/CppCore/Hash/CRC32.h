@@ -3,8 +3,34 @@
 #include <CppCore/Root.h>
 #include <CppCore/Hash/Hash.h>
 
+// Number of lookup tables used by the generic slicing-by-N step (8 or 16).
+// Slicing-by-16 needs 16KB of tables per CRC type, slicing-by-8 half of it.
+#ifndef CPPCORE_CRC32_SLICES
+#define CPPCORE_CRC32_SLICES 16
+#endif
+
 namespace CppCore
 {
+   /// <summary>
+   /// CRC32 Lookup Tables for Slicing-by-N generated at compile time from the bytewise table.
+   /// Entry t[k][i] is the CRC update of byte i followed by k zero bytes.
+   /// </summary>
+   template<size_t N>
+   class CRC32Slices
+   {
+      static_assert(N == 8U || N == 16U);
+   public:
+      uint32_t t[N][256];
+      INLINE constexpr CRC32Slices(const uint32_t* t0) : t()
+      {
+         for (size_t i = 0; i < 256U; i++)
+            t[0][i] = t0[i];
+         for (size_t k = 1; k < N; k++)
+            for (size_t i = 0; i < 256U; i++)
+               t[k][i] = (t[k-1][i] >> 8) ^ t0[t[k-1][i] & 0xFF];
+      }
+   };
+
    /// <summary>
    /// CRC32 Base Class
    /// </summary>
@@ -18,6 +44,48 @@ namespace CppCore
    protected:
       uint32_t mState;
 
+      /// <summary>
+      /// Processes N bytes per iteration using the first N tables as long as len is at least N.
+      /// Advances mem and decreases len by the processed amount. Independent of endianess.
+      /// </summary>
+      template<size_t N, size_t M>
+      INLINE static uint32_t slice(const uint32_t(&t)[M][256], uint32_t crc, const uint8_t*& mem, size_t& len)
+      {
+         static_assert(N >= 8U && N <= M);
+         while (len >= N)
+         {
+            const uint32_t v = crc ^ (
+               ((uint32_t)mem[0])       | ((uint32_t)mem[1] << 8) | 
+               ((uint32_t)mem[2] << 16) | ((uint32_t)mem[3] << 24));
+            uint32_t r = 
+               t[N-1][v & 0xFF]         ^ t[N-2][(v >> 8) & 0xFF] ^ 
+               t[N-3][(v >> 16) & 0xFF] ^ t[N-4][v >> 24];
+            CPPCORE_UNROLL
+            for (size_t i = 4; i < N; i++)
+               r ^= t[N-1-i][mem[i]];
+            crc  = r;
+            mem += N;
+            len -= N;
+         }
+         return crc;
+      }
+
+      /// <summary>
+      /// Slicing-by-N step for the generic implementations.
+      /// </summary>
+      template<size_t M>
+      INLINE void slicestep(const uint32_t(&t)[M][256], const void* data, size_t len)
+      {
+         const uint8_t* mem = (const uint8_t*)data;
+         uint32_t t32 = mState;
+         if constexpr (M >= 16U)
+            t32 = CRC32b::slice<16U>(t, t32, mem, len);
+         t32 = CRC32b::slice<8U>(t, t32, mem, len);
+         while (len--)
+            t32 = (t32 >> 8) ^ t[0][(t32 ^ *mem++) & 0xFF];
+         mState = t32;
+      }
+
    protected:
       INLINE CRC32b(const uint32_t init = INIT) 
       {
@@ -47,7 +115,7 @@ namespace CppCore
    //////////////////////////////////////////////////////////////////////////////////////////
 
    /// <summary>
-   /// CRC32 Generic
+   /// CRC32 Generic using Slicing-by-N
    /// </summary>
    class CRC32g : public CRC32b<CRC32g>
    {
@@ -88,6 +156,11 @@ namespace CppCore
          0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
       };
 
+      /// <summary>
+      /// Tables for Slicing-by-N
+      /// </summary>
+      CPPCORE_ALIGN64 static constexpr const CRC32Slices<CPPCORE_CRC32_SLICES> SLICES = CRC32Slices<CPPCORE_CRC32_SLICES>(TABLE);
+
    public:
       using Hash::step;
       using Hash::hash;
@@ -110,11 +183,7 @@ namespace CppCore
       }
       INLINE void step(const void* data, size_t len)
       {
-         uint8_t* mem = (uint8_t*)data;
-         uint32_t t32 = mState;
-         while (len--)
-            t32 = (t32 >> 8) ^ TABLE[(t32 ^ *mem++) & 0xFF];
-         mState = t32;
+         CRC32b::slicestep(SLICES.t, data, len);
       }
    };
 
@@ -183,7 +252,7 @@ namespace CppCore
    //////////////////////////////////////////////////////////////////////////////////////////
 
    /// <summary>
-   /// CRC32C Generic
+   /// CRC32C Generic using Slicing-by-N
    /// </summary>
    class CRC32Cg : public CRC32b<CRC32Cg>
    {
@@ -224,6 +293,11 @@ namespace CppCore
          0x79B737BAL, 0x8BDCB4B9L, 0x988C474DL, 0x6AE7C44EL, 0xBE2DA0A5L, 0x4C4623A6L, 0x5F16D052L, 0xAD7D5351L
       };
 
+      /// <summary>
+      /// Tables for Slicing-by-N
+      /// </summary>
+      CPPCORE_ALIGN64 static constexpr const CRC32Slices<CPPCORE_CRC32_SLICES> SLICES = CRC32Slices<CPPCORE_CRC32_SLICES>(TABLE);
+
    public:
       using Hash::step;
       using Hash::hash;
@@ -246,11 +320,7 @@ namespace CppCore
       }
       INLINE void step(const void* data, size_t len)
       {
-         uint8_t* mem = (uint8_t*)data;
-         uint32_t t32 = mState;
-         while (len--)
-            t32 = (t32 >> 8) ^ TABLE[(t32 ^ *mem++) & 0xFF];
-         mState = t32;
+         CRC32b::slicestep(SLICES.t, data, len);
       }
       INLINE void step32(const void* data, size_t len)
       {
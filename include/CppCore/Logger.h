@@ -1,37 +1,83 @@
 #pragma once
 
-#ifndef CPPCORE_LOGSIZE
-#define CPPCORE_LOGSIZE 512
+#ifndef CPPCORE_LOG_RINGSIZE
+// Bytes in the ring buffer of each logging thread (power of two)
+#define CPPCORE_LOG_RINGSIZE 65536
+#endif
+
+#ifndef CPPCORE_LOG_THREADS
+// Max. threads logging with an own ring buffer, others fail to log (see getDropped())
+#define CPPCORE_LOG_THREADS 64
+#endif
+
+#ifndef CPPCORE_LOG_CHUNKSIZE
+// Bytes in each chunk of formatted output
+#define CPPCORE_LOG_CHUNKSIZE 4096
+#endif
+
+#ifndef CPPCORE_LOG_CHUNKS
+// Max. chunks of formatted output written with one writev()
+#define CPPCORE_LOG_CHUNKS 16
 #endif
 
 #include <CppCore/Root.h>
+#include <CppCore/Encoding.h>
 #include <CppCore/Threading/Handler.h>
-#include <CppCore/Containers/Queue.h>
-#include <CppCore/Containers/Pool.h>
+
+#if defined(CPPCORE_OS_WINDOWS)
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
+/// <summary>
+/// Logs with a format string that is only parsed by the writer.
+/// Each {} in the format is replaced by the next argument.
+/// </summary>
+#define CPPCORE_LOG(logger, channel, type, format, ...)                                       \
+   do {                                                                                       \
+      static constexpr ::CppCore::Logger::Format CPPCORE_LOG_FORMAT = { format };             \
+      (logger).logf(CPPCORE_LOG_FORMAT, channel, type, ##__VA_ARGS__);                        \
+   } while (0)
 
 namespace CppCore
 {
    /// <summary>
-   /// Logger
+   /// Logger.
+   /// Each logging thread owns a lock-free single producer ring buffer. Log calls only
+   /// store the address of a constant format, a raw timestamp and the binary arguments.
+   /// Formatting is deferred to the writer runnable on the thread pool. It merges the
+   /// rings by timestamp and writes the lines in batches with one writev().
    /// </summary>
    class Logger
    {
+      static_assert(CPPCORE_LOG_RINGSIZE >= 1024 && (CPPCORE_LOG_RINGSIZE & (CPPCORE_LOG_RINGSIZE - 1)) == 0);
+      static_assert(CPPCORE_LOG_CHUNKS > 0 && CPPCORE_LOG_CHUNKSIZE > 0);
+
    public:
       enum Channel { App, Log, Network, GUI, Resources, Data, Chat, Factory, Other };
       enum Type { Error, Warning, Info, Debug };
 
       /// <summary>
-      /// Log Entry
+      /// Constant format of log calls, its address identifies it.
+      /// Each {} in Text is replaced by the next argument.
       /// </summary>
-      struct LogEntry
+      struct Format
       {
-      public:
-         size_t     Channel;
-         Type       Type;
-         time_t     Time;
-         thread::id ThreadId;
-         string     Message;
-         INLINE size_t memOnHeap() { return Message.capacity() + 1; }
+         const char* Text;
+      };
+
+      /// <summary>
+      /// Chunk of formatted output
+      /// </summary>
+      struct Chunk
+      {
+         size_t Length;
+         char   Data[CPPCORE_LOG_CHUNKSIZE];
       };
 
       /// <summary>
@@ -53,36 +99,583 @@ namespace CppCore
          INLINE void logDebug(const string& message) { this->log(message, Logger::Type::Debug);   }
       };
 
-      typedef Queue::MT<LogEntry*, CPPCORE_LOGSIZE>    LogQueue;
-      typedef Pool::Fix::MT<LogEntry, CPPCORE_LOGSIZE> LogPool;
-
    protected:
+      static constexpr size_t RINGSIZE  = CPPCORE_LOG_RINGSIZE;
+      static constexpr size_t RINGMASK  = RINGSIZE - 1U;
+      static constexpr size_t MAXRECORD = RINGSIZE / 4U;
+      static constexpr size_t MAXSTRING = MAXRECORD - 128U;
+      static constexpr size_t CACHES    = 4U;
+      static constexpr size_t NOCURSOR  = numeric_limits<size_t>::max();
+
+      /// <summary>
+      /// Type tag of a binary argument
+      /// </summary>
+      enum class ArgType : uint8_t { Bool, Char, Int, UInt, Double, String, Pointer };
+
+      /// <summary>
+      /// Header of a log call in a ring, followed by its arguments.
+      /// A header without format skips the rest of the ring.
+      /// </summary>
+      struct CPPCORE_ALIGN8 Record
+      {
+         const Format* FormatId;
+         uint64_t      Time;
+         thread::id    ThreadId;
+         uint32_t      Size;
+         uint16_t      Channel;
+         uint8_t       Type;
+         uint8_t       Args;
+      };
+
+      /// <summary>
+      /// Ring buffer of log records with one producer thread and the writer as consumer.
+      /// Positions only grow and are masked for access.
+      /// </summary>
+      class CPPCORE_ALIGN64 Ring
+      {
+      public:
+         // producer
+         CPPCORE_ALIGN64 atomic<size_t> mHead;
+         size_t       mLimit;
+         char*        mData;
+         atomic<bool> mUsed;
+         // writer
+         CPPCORE_ALIGN64 atomic<size_t> mTail;
+         thread::id   mLabelId;
+         size_t       mLabelLength;
+         char         mLabel[48];
+         INLINE Ring() : mHead(0), mLimit(RINGSIZE), mData(nullptr), mUsed(false),
+            mTail(0), mLabelLength(0) { }
+
+         /// <summary>
+         /// Reserves size bytes for the next record and returns it or nullptr if full.
+         /// Skips the rest of the ring if the record does not fit in there.
+         /// Publish it with commit().
+         /// </summary>
+         INLINE Record* reserve(const size_t size, size_t& head)
+         {
+            head = mHead.load(::std::memory_order_relaxed);
+            const size_t OFF = head & RINGMASK;
+            const size_t PAD = OFF + size > RINGSIZE ? RINGSIZE - OFF : 0U;
+            if (head + PAD + size > mLimit) CPPCORE_UNLIKELY
+            {
+               mLimit = mTail.load(::std::memory_order_acquire) + RINGSIZE;
+               if (head + PAD + size > mLimit)
+                  return nullptr;
+            }
+            if (PAD)
+            {
+               ((Record*)(mData + OFF))->FormatId = nullptr;
+               head += PAD;
+            }
+            Record* r = (Record*)(mData + (head & RINGMASK));
+            head += size;
+            return r;
+         }
+
+         /// <summary>
+         /// Publishes the records up to head to the writer.
+         /// </summary>
+         INLINE void commit(const size_t head)
+         {
+            mHead.store(head, ::std::memory_order_release);
+         }
+      };
+
+      /// <summary>
+      /// Ring of a thread in a logger, identified by address and id.
+      /// The id tells apart a logger created at the address of a deleted one.
+      /// </summary>
+      struct Cache
+      {
+         Logger*  logger;
+         uint64_t id;
+         Ring*    ring;
+      };
+
+      /// <summary>
+      /// Per thread, the rings of up to CACHES loggers in any entry.
+      /// A further logger replaces them round-robin.
+      /// Gives back the rings when the thread exits.
+      /// </summary>
+      class ThreadCaches
+      {
+      public:
+         Cache      mEntries[CACHES];
+         size_t     mVictim;
+         thread::id mThreadId;
+         INLINE ThreadCaches() : mVictim(0), mThreadId(::std::this_thread::get_id()) { CppCore::clear(mEntries); }
+         INLINE ~ThreadCaches()
+         {
+            for (size_t i = 0; i < CACHES; i++)
+               Logger::detach(mEntries[i]);
+         }
+
+         /// <summary>
+         /// Returns an unused entry or else the next one to replace.
+         /// </summary>
+         INLINE Cache& evict()
+         {
+            for (size_t i = 0; i < CACHES; i++)
+               if (!mEntries[i].logger)
+                  return mEntries[i];
+            return mEntries[mVictim++ % CACHES];
+         }
+      };
+
+      /// <summary>
+      /// Position of the writer in a ring
+      /// </summary>
+      struct Cursor
+      {
+         Ring*  ring;
+         size_t pos;
+         size_t end;
+      };
+
       Handler&    mThreadPool;
       Runnable    mRunnableLog;
-      LogQueue    mQueue;
-      LogPool     mPool;
-      ofstream    mStream;
       std::locale mLocale;
       bool        mLogToConsole;
       bool        mLogToFile;
+      int         mFile;
+      const uint64_t mId;
+      atomic<uint64_t> mDropped;
+      Logger*        mPrevAlive;
+      Logger*        mNextAlive;
+      CPPCORE_ALIGN64 Ring mRings[CPPCORE_LOG_THREADS];
+      Cursor   mCursors[CPPCORE_LOG_THREADS];
+      Chunk    mChunks[CPPCORE_LOG_CHUNKS];
+      size_t   mNumChunks;
+      mutex    mWriterMutex;
+      uint64_t mCalTime;
+      double   mCalSeconds;
+      double   mSecondsPerTick;
+      int64_t  mLastSecond;
+      char     mLastSecondText[32];
+      size_t   mLastSecondLength;
 
-   private:
       /// <summary>
-      /// Internal Writer Method executed by ThreadPool
+      /// Lock for the list of alive loggers
       /// </summary>
-      INLINE void writer()
+      INLINE static mutex& aliveLock()
       {
-         LogEntry* entry;
+         static mutex lock;
+         return lock;
+      }
 
-         // try get pending log entry
-         while (mQueue.popFront(entry))
+      /// <summary>
+      /// First in list of alive loggers
+      /// </summary>
+      INLINE static Logger*& aliveHead()
+      {
+         static Logger* head = nullptr;
+         return head;
+      }
+
+      /// <summary>
+      /// Unique id for a new logger
+      /// </summary>
+      INLINE static uint64_t nextId()
+      {
+         static atomic<uint64_t> counter(1);
+         return counter.fetch_add(1U, ::std::memory_order_relaxed);
+      }
+
+      /// <summary>
+      /// Caches of calling thread
+      /// </summary>
+      INLINE static ThreadCaches& threadCaches()
+      {
+         static thread_local ThreadCaches caches;
+         return caches;
+      }
+
+      /// <summary>
+      /// Gives back the ring of a cache entry if its logger is still alive.
+      /// Records left in it are still written.
+      /// </summary>
+      INLINE static void detach(Cache& c)
+      {
+         if (!c.logger)
+            return;
+         if (c.ring)
          {
-            // write it
-            write(*entry);
+            unique_lock<mutex> lock(aliveLock());
+            for (Logger* p = aliveHead(); p; p = p->mNextAlive)
+            {
+               if (p == c.logger && p->mId == c.id)
+               {
+                  c.ring->mUsed.store(false, ::std::memory_order_release);
+                  break;
+               }
+            }
+         }
+         c.logger = nullptr;
+         c.id = 0;
+         c.ring = nullptr;
+      }
 
-            // add back to free ones
-            mPool.pushBack(entry);
+      /// <summary>
+      /// Slow path of ring() on first log call of a thread into this logger.
+      /// Takes over the cache entry and tries to get a free ring.
+      /// </summary>
+      INLINE Ring* attach(Cache& c)
+      {
+         detach(c);
+         c.logger = this;
+         c.id = mId;
+         for (size_t i = 0; i < CPPCORE_LOG_THREADS; i++)
+         {
+            Ring& r = mRings[i];
+            bool expected = false;
+            if (r.mUsed.compare_exchange_strong(expected, true, ::std::memory_order_acquire))
+            {
+               if (!r.mData)
+                  r.mData = new char[RINGSIZE];
+               c.ring = &r;
+               break;
+            }
          }
+         return c.ring;
+      }
+
+      /// <summary>
+      /// Raw timestamp of a log call, converted by the writer.
+      /// </summary>
+      INLINE static uint64_t timestamp()
+      {
+      #if defined(CPPCORE_CPU_X86ORX64)
+         return (uint64_t)__rdtsc();
+      #elif defined(CPPCORE_CPU_ARM64) && defined(CPPCORE_COMPILER_CLANG)
+         uint64_t t;
+         __asm volatile ("MRS %0, CNTVCT_EL0;" : "=r"(t) :: "memory");
+         return t;
+      #else
+         return (uint64_t)ClockHR::now().time_since_epoch().count();
+      #endif
+      }
+
+      /// <summary>
+      /// Format for log() with a plain message
+      /// </summary>
+      INLINE static const Format& formatMessage()
+      {
+         static constexpr Format FORMAT = { "{}" };
+         return FORMAT;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // ARGUMENT ENCODING
+
+      /// <summary>
+      /// Returns string argument as string view, up to MAXSTRING bytes
+      /// </summary>
+      template<typename A>
+      INLINE static string_view argString(const A& a)
+      {
+         using T = typename ::std::decay<A>::type;
+         string_view s;
+         if constexpr (::std::is_same_v<T, const char*> || ::std::is_same_v<T, char*>)
+            s = a ? string_view(a) : string_view("(null)");
+         else
+            s = string_view(a);
+         return s.size() <= MAXSTRING ? s : s.substr(0, MAXSTRING);
+      }
+
+      /// <summary>
+      /// Returns encoded bytes of argument
+      /// </summary>
+      template<typename A>
+      INLINE static size_t argSize(const A& a)
+      {
+         if constexpr (::std::is_convertible_v<const A&, string_view>)
+            return 1U + 4U + argString(a).size();
+         else
+            return 1U + 8U;
+      }
+
+      /// <summary>
+      /// Writes type tag and value of argument to p and returns end
+      /// </summary>
+      template<typename A>
+      INLINE static char* argWrite(char* p, const A& a)
+      {
+         using T = typename ::std::decay<A>::type;
+         if constexpr (::std::is_convertible_v<const A&, string_view>)
+         {
+            const string_view s = argString(a);
+            const uint32_t n = (uint32_t)s.size();
+            *p++ = (char)ArgType::String;
+            ::memcpy(p, &n, 4U);
+            ::memcpy(p + 4U, s.data(), n);
+            return p + 4U + n;
+         }
+         else
+         {
+            uint64_t v;
+            if constexpr (::std::is_same_v<T, bool>)
+            {
+               *p++ = (char)ArgType::Bool;
+               v = a ? 1U : 0U;
+            }
+            else if constexpr (::std::is_same_v<T, char>)
+            {
+               *p++ = (char)ArgType::Char;
+               v = (uint8_t)a;
+            }
+            else if constexpr (::std::is_enum_v<T> || (::std::is_integral_v<T> && ::std::is_signed_v<T>))
+            {
+               *p++ = (char)ArgType::Int;
+               v = (uint64_t)(int64_t)a;
+            }
+            else if constexpr (::std::is_integral_v<T>)
+            {
+               *p++ = (char)ArgType::UInt;
+               v = (uint64_t)a;
+            }
+            else if constexpr (::std::is_floating_point_v<T>)
+            {
+               const double d = (double)a;
+               *p++ = (char)ArgType::Double;
+               ::memcpy(&v, &d, 8U);
+            }
+            else if constexpr (::std::is_pointer_v<T>)
+            {
+               *p++ = (char)ArgType::Pointer;
+               v = (uint64_t)(uintptr_t)a;
+            }
+            else
+               static_assert(::std::is_pointer_v<T>, "Unsupported log argument type");
+            ::memcpy(p, &v, 8U);
+            return p + 8U;
+         }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // WRITER
+
+      /// <summary>
+      /// Appends bytes to the chunks and writes them when all are full
+      /// </summary>
+      INLINE void append(const char* s, size_t len)
+      {
+         while (len)
+         {
+            Chunk& c = mChunks[mNumChunks];
+            const size_t N = ::std::min(len, CPPCORE_LOG_CHUNKSIZE - c.Length);
+            ::memcpy(&c.Data[c.Length], s, N);
+            c.Length += N;
+            s   += N;
+            len -= N;
+            if (c.Length == CPPCORE_LOG_CHUNKSIZE && ++mNumChunks == CPPCORE_LOG_CHUNKS)
+               flushChunks();
+         }
+      }
+
+      /// <summary>
+      /// Appends zero-terminated string
+      /// </summary>
+      INLINE void append(const char* s)
+      {
+         append(s, ::strlen(s));
+      }
+
+      /// <summary>
+      /// Writes the filled chunks
+      /// </summary>
+      INLINE void flushChunks()
+      {
+         const size_t NUM = mNumChunks + (mNumChunks < CPPCORE_LOG_CHUNKS && mChunks[mNumChunks].Length ? 1U : 0U);
+         if (NUM)
+            write(mChunks, NUM);
+         for (size_t i = 0; i < NUM; i++)
+            mChunks[i].Length = 0;
+         mNumChunks = 0;
+      }
+
+      /// <summary>
+      /// Appends the decoded argument at p and returns its end
+      /// </summary>
+      INLINE const char* appendArg(const char* p)
+      {
+         char     s[32];
+         uint64_t v;
+         const ArgType TYPE = (ArgType)*p++;
+         if (TYPE == ArgType::String)
+         {
+            uint32_t n;
+            ::memcpy(&n, p, 4U);
+            append(p + 4U, n);
+            return p + 4U + n;
+         }
+         ::memcpy(&v, p, 8U);
+         switch (TYPE)
+         {
+         case ArgType::Bool:  append(v ? "true" : "false"); break;
+         case ArgType::Char:  s[0] = (char)v; append(s, 1U); break;
+         case ArgType::Int:   append(s, Decimal::tostring((int64_t)v, s, false) - s); break;
+         case ArgType::UInt:  append(s, Decimal::tostring((uint64_t)v, s, false) - s); break;
+         case ArgType::Double:
+         {
+            double d;
+            ::memcpy(&d, &v, 8U);
+            const int N = ::snprintf(s, sizeof(s), "%.17g", d);
+            append(s, N > 0 ? ::std::min((size_t)N, sizeof(s) - 1U) : 0U);
+            break;
+         }
+         case ArgType::Pointer:
+            s[0] = '0'; s[1] = 'x';
+            Hex::tostring(v, s + 2, true, false, true);
+            append(s, 18U);
+            break;
+         default: break;
+         }
+         return p + 8U;
+      }
+
+      /// <summary>
+      /// Appends thread id, cached per ring as its threads rarely change
+      /// </summary>
+      INLINE void appendThread(Ring& ring, const thread::id& id)
+      {
+         if (ring.mLabelId != id || !ring.mLabelLength)
+         {
+            stringstream ss;
+            ss.imbue(mLocale);
+            ss << ::std::setw(5) << ::std::setfill('0') << id;
+            const string s = ss.str();
+            ring.mLabelId = id;
+            ring.mLabelLength = ::std::min(s.length(), sizeof(ring.mLabel));
+            ::memcpy(ring.mLabel, s.data(), ring.mLabelLength);
+         }
+         append(ring.mLabel, ring.mLabelLength);
+      }
+
+      /// <summary>
+      /// Appends utc date and time of raw timestamp, cached per second
+      /// </summary>
+      INLINE void appendTime(const uint64_t time)
+      {
+         const int64_t SECONDS = (int64_t)::floor(
+            mCalSeconds + (double)(int64_t)(time - mCalTime) * mSecondsPerTick);
+         if (SECONDS != mLastSecond)
+         {
+            const time_t t = (time_t)SECONDS;
+            const ::std::tm* gm = ::std::gmtime(&t);
+            mLastSecond = SECONDS;
+            mLastSecondLength = gm ? ::strftime(mLastSecondText, sizeof(mLastSecondText), "%Y/%m/%d|%H:%M:%S|", gm) : 0U;
+         }
+         append(mLastSecondText, mLastSecondLength);
+      }
+
+      /// <summary>
+      /// Appends formatted line of a record
+      /// </summary>
+      INLINE void appendRecord(Ring& ring, const Record& r)
+      {
+         appendTime(r.Time);
+         appendThread(ring, r.ThreadId);
+         append("|", 1U);
+         append(stringOfChannel(r.Channel));
+         append("|", 1U);
+         append(stringOfLogType(r.Type));
+         append("||", 2U);
+
+         const char* args = (const char*)(&r + 1);
+         size_t      left = r.Args;
+         const char* f    = r.FormatId->Text;
+         const char* s    = f;
+         while (*f)
+         {
+            if (f[0] == '{' && f[1] == '}' && left)
+            {
+               append(s, f - s);
+               args = appendArg(args);
+               left--;
+               f += 2;
+               s = f;
+            }
+            else
+               f++;
+         }
+         append(s, f - s);
+         append("\n", 1U);
+      }
+
+      /// <summary>
+      /// Seconds since epoch
+      /// </summary>
+      INLINE static double seconds()
+      {
+         return ::std::chrono::duration<double>(system_clock::now().time_since_epoch()).count();
+      }
+
+      /// <summary>
+      /// Updates the conversion of raw timestamps to seconds since epoch.
+      /// Measures the tick rate since the last reference point and takes a new one every minute.
+      /// </summary>
+      INLINE void calibrate()
+      {
+         const uint64_t TIME = timestamp();
+         const double   NOW  = seconds();
+         if (NOW > mCalSeconds && TIME > mCalTime)
+            mSecondsPerTick = (NOW - mCalSeconds) / (double)(TIME - mCalTime);
+         if (NOW - mCalSeconds > 60.0)
+         {
+            mCalTime = TIME;
+            mCalSeconds = NOW;
+         }
+      }
+
+      /// <summary>
+      /// Internal Writer Method executed by ThreadPool.
+      /// Merges the pending records of all rings by timestamp.
+      /// </summary>
+      INLINE void writer()
+      {
+         unique_lock<mutex> lock(mWriterMutex);
+         size_t num = 0;
+         for (size_t i = 0; i < CPPCORE_LOG_THREADS; i++)
+         {
+            Ring& r = mRings[i];
+            const size_t HEAD = r.mHead.load(::std::memory_order_acquire);
+            const size_t TAIL = r.mTail.load(::std::memory_order_relaxed);
+            if (HEAD != TAIL)
+               mCursors[num++] = { &r, TAIL, HEAD };
+         }
+         if (!num)
+            return;
+
+         calibrate();
+         while (num)
+         {
+            // skip wrapped ends, release drained rings and pick earliest record
+            size_t best = NOCURSOR;
+            for (size_t i = 0; i < num; )
+            {
+               Cursor& c = mCursors[i];
+               if (c.pos != c.end && !((Record*)(c.ring->mData + (c.pos & RINGMASK)))->FormatId)
+                  c.pos += RINGSIZE - (c.pos & RINGMASK);
+               if (c.pos == c.end)
+               {
+                  c.ring->mTail.store(c.end, ::std::memory_order_release);
+                  c = mCursors[--num];
+                  continue;
+               }
+               if (best == NOCURSOR || ((Record*)(c.ring->mData + (c.pos & RINGMASK)))->Time <
+                  ((Record*)(mCursors[best].ring->mData + (mCursors[best].pos & RINGMASK)))->Time)
+                  best = i;
+               i++;
+            }
+            if (!num)
+               break;
+            Cursor& c = mCursors[best];
+            const Record& r = *(Record*)(c.ring->mData + (c.pos & RINGMASK));
+            appendRecord(*c.ring, r);
+            c.pos += r.Size;
+         }
+         flushChunks();
       }
 
    protected:
@@ -121,36 +714,67 @@ namespace CppCore
          }
       }
 
+   #if defined(CPPCORE_OS_WINDOWS)
       /// <summary>
-      /// Override this with logging to somewhere else than console
+      /// Writes chunks to file descriptor
       /// </summary>
-      INLINE virtual void write(const LogEntry& entry)
+      INLINE static void write(const int fd, const Chunk* chunks, const size_t num)
       {
-         // convert timestamp to utc time
-         const ::std::tm* gm = ::std::gmtime(&entry.Time);
-
-         stringstream ss;
-
-         // workaround? (fixes comma in thread id ints but maintains  in message)
-         ss.imbue(mLocale);
-
-         // build log
-         ss << ::std::put_time(gm, "%Y/%m/%d|%H:%M:%S|")
-            << ::std::setw(5) << ::std::setfill('0') << entry.ThreadId << '|'
-            << stringOfChannel(entry.Channel) << '|'
-            << stringOfLogType(entry.Type) << "||"
-            << entry.Message << ::std::endl;
+         for (size_t i = 0; i < num; i++)
+            ::_write(fd, chunks[i].Data, (unsigned int)chunks[i].Length);
+      }
+   #else
+      /// <summary>
+      /// Writes chunks to file descriptor with writev() calls
+      /// </summary>
+      INLINE static void write(const int fd, const Chunk* chunks, const size_t num)
+      {
+         iovec  vecs[CPPCORE_LOG_CHUNKS];
+         iovec* v = vecs;
+         int    n = (int)num;
+         for (size_t i = 0; i < num; i++)
+         {
+            vecs[i].iov_base = (void*)chunks[i].Data;
+            vecs[i].iov_len  = chunks[i].Length;
+         }
+         while (n > 0)
+         {
+            ssize_t r = ::writev(fd, v, n);
+            if (r < 0)
+            {
+               if (errno == EINTR) continue;
+               else break;
+            }
+            while (n > 0 && (size_t)r >= v->iov_len)
+            {
+               r -= (ssize_t)v->iov_len;
+               v++;
+               n--;
+            }
+            if (n > 0)
+            {
+               v->iov_base = (char*)v->iov_base + r;
+               v->iov_len -= (size_t)r;
+            }
+         }
+      }
+   #endif
 
+      /// <summary>
+      /// Override this with logging to somewhere else than console and file.
+      /// Gets batches of formatted lines. Console output goes straight to
+      /// fd 1 and is not ordered with std::cout. The final write in ~Logger()
+      /// can't reach an override, call flush() in the derived destructor.
+      /// </summary>
+      INLINE virtual void write(const Chunk* chunks, const size_t num)
+      {
          // log to console
          if (mLogToConsole)
-            ::std::cout << ss.str();
+            write(1, chunks, num);
 
          // log to file
-         if (mLogToFile && mStream.is_open())
-         {
-            mStream << ss.str();
-            mStream.flush();
-         }
+         if (mLogToFile && mFile >= 0)
+            write(mFile, chunks, num);
       }
 
    public:
@@ -158,20 +782,48 @@ namespace CppCore
       /// Constructor
       /// </summary>
       INLINE Logger(
-         Handler&         threadPool, 
-         bool             logToConsole = true, 
-         bool             logToFile    = true, 
+         Handler&         threadPool,
+         bool             logToConsole = true,
+         bool             logToFile    = true,
          const path&      logFile      = "app.log",
          const DurationHR logInterval  = milliseconds(100)) :
          mThreadPool(threadPool),
+         mRunnableLog([this]() { writer(); }, logInterval),
+         mLocale(std::locale("C")),
          mLogToConsole(logToConsole),
          mLogToFile(logToFile),
-         mLocale(std::locale("C")),
-         mRunnableLog([this]() { writer(); }, logInterval)
+         mFile(-1),
+         mId(nextId()),
+         mDropped(0),
+         mPrevAlive(nullptr),
+         mNumChunks(0),
+         mCalTime(timestamp()),
+         mCalSeconds(seconds()),
+         mSecondsPerTick(0.0),
+         mLastSecond(-1),
+         mLastSecondLength(0)
       {
-         // init logfile stream
+         for (size_t i = 0; i < CPPCORE_LOG_CHUNKS; i++)
+            mChunks[i].Length = 0;
+
+         // open logfile
          if (logToFile)
-            mStream = ofstream(logFile, ofstream::out);
+         {
+         #if defined(CPPCORE_OS_WINDOWS)
+            mFile = ::_wopen(logFile.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+         #else
+            mFile = ::open(logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+         #endif
+         }
+
+         // add to alive ones
+         {
+            unique_lock<mutex> lock(aliveLock());
+            mNextAlive = aliveHead();
+            if (mNextAlive)
+               mNextAlive->mPrevAlive = this;
+            aliveHead() = this;
+         }
 
          // schedule the log timer
          threadPool.schedule(mRunnableLog, ClockHR::now() + logInterval);
@@ -181,49 +833,122 @@ namespace CppCore
       }
 
       /// <summary>
-      /// Destructor
+      /// Destructor. Writes pending logs.
       /// </summary>
       INLINE ~Logger()
       {
-         if (mStream.is_open())
+         mThreadPool.cancel(mRunnableLog);
+
+         // remove from alive ones, threads don't give back rings anymore
+         {
+            unique_lock<mutex> lock(aliveLock());
+            if (mPrevAlive) mPrevAlive->mNextAlive = mNextAlive;
+            else            aliveHead() = mNextAlive;
+            if (mNextAlive)
+               mNextAlive->mPrevAlive = mPrevAlive;
+         }
+
+         writer();
+
+         for (size_t i = 0; i < CPPCORE_LOG_THREADS; i++)
+            delete[] mRings[i].mData;
+
+         if (mFile >= 0)
          {
-            mStream.flush();
-            mStream.close();
+         #if defined(CPPCORE_OS_WINDOWS)
+            ::_close(mFile);
+         #else
+            ::close(mFile);
+         #endif
          }
       }
 
       /// <summary>
-      /// Create a log entry
+      /// Ring of calling thread or nullptr if it has none.
       /// </summary>
-      INLINE bool log(const string& message, const size_t channel = 0, const Type type = Type::Info)
+      INLINE Ring* ring()
+      {
+         ThreadCaches& caches = threadCaches();
+         for (size_t i = 0; i < CACHES; i++)
+         {
+            Cache& c = caches.mEntries[i];
+            if (c.logger == this && c.id == mId)
+               return c.ring;
+         }
+         return attach(caches.evict());
+      }
+
+      /// <summary>
+      /// Create a log entry with a constant format, see CPPCORE_LOG.
+      /// Supports integer, floating point, bool, char, pointer and string arguments.
+      /// Strings are copied, longer ones than about a quarter of the ring size are cut.
+      /// Fails if the ring of the thread is full or all rings are used by other threads.
+      /// The latter is counted in getDropped().
+      /// </summary>
+      template<typename... ARGS>
+      INLINE bool logf(const Format& format, const size_t channel, const Type type, const ARGS&... args)
       {
+         static_assert(sizeof...(ARGS) < 256U);
+
          // logging fully disabled
          if (!mLogToFile && !mLogToConsole)
             return true;
 
-         LogEntry* entry;
-
-         // try get free log entry
-         if (mPool.popBack(entry))
+         Ring* ring = this->ring();
+         if (!ring) CPPCORE_UNLIKELY
          {
-            // set log values
-            entry->Message = message;
-            entry->Channel = channel;
-            entry->Type = type;
-            entry->Time = ::std::time(0);
-            entry->ThreadId = ::std::this_thread::get_id();
+            mDropped.fetch_add(1U, ::std::memory_order_relaxed);
+            return false;
+         }
 
-            // try enqueue it for logging
-            if (mQueue.pushBack(entry))
-               return true;
+         const size_t SIZE = (sizeof(Record) + (0U + ... + argSize(args)) + 7U) & ~(size_t)7U;
+         if (SIZE > MAXRECORD) CPPCORE_UNLIKELY
+            return false;
 
-            // push back to free ones if failed
-            else
-               mPool.pushBack(entry);
+         size_t  head;
+         Record* r = ring->reserve(SIZE, head);
+         if (!r) CPPCORE_UNLIKELY
+            return false;
+
+         r->FormatId = &format;
+         r->Time     = timestamp();
+         r->ThreadId = threadCaches().mThreadId;
+         r->Size     = (uint32_t)SIZE;
+         r->Channel  = (uint16_t)channel;
+         r->Type     = (uint8_t)type;
+         r->Args     = (uint8_t)sizeof...(ARGS);
+         if constexpr (sizeof...(ARGS) > 0)
+         {
+            char* p = (char*)(r + 1);
+            ((p = argWrite(p, args)), ...);
          }
+         ring->commit(head);
+         return true;
+      }
 
-         // failed
-         return false;
+      /// <summary>
+      /// Create a log entry
+      /// </summary>
+      INLINE bool log(const string& message, const size_t channel = 0, const Type type = Type::Info)
+      {
+         return logf(formatMessage(), channel, type, message);
+      }
+
+      /// <summary>
+      /// Writes pending log entries now on the calling thread.
+      /// </summary>
+      INLINE void flush()
+      {
+         writer();
+      }
+
+      /// <summary>
+      /// Records dropped because more than CPPCORE_LOG_THREADS threads
+      /// were logging at once and their thread got no ring.
+      /// </summary>
+      INLINE uint64_t getDropped() const
+      {
+         return mDropped.load(::std::memory_order_relaxed);
       }
    };
 }
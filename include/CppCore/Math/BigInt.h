@@ -1863,7 +1863,7 @@ namespace CppCore
          /// </summary>
          INLINE static void mul(const TC& a, const TC& b, TC& r)
          {
-            CppCore::umul(a, b, r);
+            CppCore::umulk(a, b, r);
          }
 
          /// <summary>
@@ -1892,7 +1892,7 @@ namespace CppCore
          INLINE static void mulw(const TC& a, const TC& b, uint64_t r[N64+N64])
          {
             struct TCX2 { uint64_t x[N64+N64]; };
-            CppCore::umul(a, b, *(TCX2*)r);
+            CppCore::umulk(a, b, *(TCX2*)r);
          }
 
          /// <summary>
@@ -1913,6 +1913,23 @@ namespace CppCore
             TC::Op::mulw(a, b64, r);
          }
 
+         /// <summary>
+         /// Squaring (a*a=r)
+         /// </summary>
+         INLINE static void square(const TC& a, TC& r)
+         {
+            CppCore::umulk(a, a, r);
+         }
+
+         /// <summary>
+         /// Wide Squaring (a*a=r)
+         /// </summary>
+         INLINE static void squarew(const TC& a, uint64_t r[N64+N64])
+         {
+            struct TCX2 { uint64_t x[N64+N64]; };
+            CppCore::usquare(a, *(TCX2*)r);
+         }
+
          /// <summary>
          /// Division+Modulo (a/b=q,r)(same type).
          /// </summary>
@@ -2685,12 +2702,8 @@ namespace CppCore
       /// </summary>
       constexpr INLINE static TC parseDecimal(const char* input)
       {
-         TC r(0ULL);
-         while(const char c = *input++)
-         {
-            r *= 10U;
-            r += (c - '0');
-         }
+         TC r;
+         BaseX::parse(input, r, CPPCORE_ALPHABET_B10);
          return r;
       }
 
@@ -1,5 +1,15 @@
 #pragma once
 
+#ifndef CPPCORE_KARATSUBA_THRESHOLD
+// Min. 64-Bit limbs of factors for a Karatsuba split, schoolbook multiplication below
+#define CPPCORE_KARATSUBA_THRESHOLD 32
+#endif
+
+#ifndef CPPCORE_KARATSUBA_SQUARE_THRESHOLD
+// Min. 64-Bit limbs for a Karatsuba split in squaring, schoolbook squaring below
+#define CPPCORE_KARATSUBA_SQUARE_THRESHOLD 32
+#endif
+
 #include <CppCore/Root.h>
 #include <CppCore/BitOps.h>
 
@@ -2882,6 +2892,226 @@ namespace CppCore
       r = a * b;
    }
 
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+   // KARATSUBA MULTIPLICATION AND SQUARING
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+   /// <summary>
+   /// Absolute Difference (|a-b|=r) of N 64-Bit limbs. Returns true if a is less than b.
+   /// </summary>
+   template<size_t N>
+   INLINE static bool usubabs(const uint64_t* a, const uint64_t* b, uint64_t* r)
+   {
+      uint8_t c = 0;
+      for (size_t i = 0; i < N; i++)
+         CppCore::subborrow64(a[i], b[i], r[i], c);
+      if (c)
+      {
+         // negate
+         uint8_t k = 1;
+         for (size_t i = 0; i < N; i++)
+            CppCore::addcarry64(~r[i], 0ULL, r[i], k);
+      }
+      return c != 0;
+   }
+
+   /// <summary>
+   /// Adds the Karatsuba middle term (z0+z2-m or z0+z2+m) at limb N/2 of r.
+   /// Expects z0 in the lower and z2 in the upper N limbs of r.
+   /// </summary>
+   template<size_t N>
+   INLINE static void ukaratsubamid(uint64_t* r, const uint64_t* m, const bool add)
+   {
+      constexpr size_t H = N / 2U;
+      uint64_t t[N];
+      uint64_t k;
+      uint8_t  c = 0;
+      for (size_t i = 0; i < N; i++)
+         CppCore::addcarry64(r[i], r[N+i], t[i], c);
+      k = c;
+      c = 0;
+      if (add)
+      {
+         for (size_t i = 0; i < N; i++)
+            CppCore::addcarry64(t[i], m[i], t[i], c);
+         k += c;
+      }
+      else
+      {
+         for (size_t i = 0; i < N; i++)
+            CppCore::subborrow64(t[i], m[i], t[i], c);
+         k -= c;
+      }
+      c = 0;
+      for (size_t i = 0; i < N; i++)
+         CppCore::addcarry64(r[H+i], t[i], r[H+i], c);
+      k += c;
+      for (size_t i = H+N; i < N+N && k; i++)
+      {
+         c = 0;
+         CppCore::addcarry64(r[i], k, r[i], c);
+         k = c;
+      }
+   }
+
+   /// <summary>
+   /// Schoolbook Squaring (a*a=r) of N 64-Bit limbs into 2N limbs.
+   /// Computes each cross product a[i]*a[j] with i less than j only once and doubles them.
+   /// </summary>
+   template<size_t N>
+   INLINE static void usquareschool(const uint64_t* a, uint64_t* r)
+   {
+      uint64_t tl, th, k;
+      uint8_t  c;
+
+      // cross products a[i]*a[j] with i<j
+      for (size_t i = 0; i < N; i++)
+         r[i] = 0ULL;
+      for (size_t i = 0; i < N; i++)
+      {
+         const uint64_t ai = a[i];
+         k = 0ULL;
+         for (size_t j = i+1; j < N; j++)
+         {
+            CppCore::umul128(ai, a[j], tl, th);
+            c = 0;
+            CppCore::addcarry64(tl, r[i+j], tl, c);
+            CppCore::addcarry64(th, 0ULL, th, c);
+            c = 0;
+            CppCore::addcarry64(tl, k, r[i+j], c);
+            CppCore::addcarry64(th, 0ULL, k, c);
+         }
+         r[i+N] = k;
+      }
+
+      // double them
+      for (size_t i = 2*N-1; i > 0; i--)
+         r[i] = (r[i] << 1) | (r[i-1] >> 63);
+      r[0] <<= 1;
+
+      // add squares a[i]*a[i]
+      c = 0;
+      for (size_t i = 0; i < N; i++)
+      {
+         CppCore::umul128(a[i], a[i], tl, th);
+         CppCore::addcarry64(r[2*i],   tl, r[2*i],   c);
+         CppCore::addcarry64(r[2*i+1], th, r[2*i+1], c);
+      }
+   }
+
+   /// <summary>
+   /// Karatsuba Multiplication (a*b=r) of N 64-Bit limbs into 2N limbs in O(n^1.58).
+   /// Splits in halves while at least CPPCORE_KARATSUBA_THRESHOLD limbs, else uses schoolbook umul().
+   /// Uses the subtractive variant z1=z0+z2-(a0-a1)*(b0-b1) so no half exceeds N/2 limbs.
+   /// r must not alias a or b.
+   /// </summary>
+   template<size_t N>
+   INLINE static void umulkaratsuba(const uint64_t* a, const uint64_t* b, uint64_t* r)
+   {
+      if constexpr (N < CPPCORE_KARATSUBA_THRESHOLD || N % 2U != 0U)
+      {
+         struct TN  { uint64_t x[N]; };
+         struct TN2 { uint64_t x[N+N]; };
+         CppCore::umul(*(const TN*)a, *(const TN*)b, *(TN2*)r);
+      }
+      else
+      {
+         constexpr size_t H = N / 2U;
+         uint64_t da[H], db[H], m[N];
+         CppCore::umulkaratsuba<H>(a, b, r);
+         CppCore::umulkaratsuba<H>(a+H, b+H, r+N);
+         const bool SA = CppCore::usubabs<H>(a, a+H, da);
+         const bool SB = CppCore::usubabs<H>(b, b+H, db);
+         CppCore::umulkaratsuba<H>(da, db, m);
+         CppCore::ukaratsubamid<N>(r, m, SA != SB);
+      }
+   }
+
+   /// <summary>
+   /// Karatsuba Multiplication (a*b=r) of N 64-Bit limbs keeping the lower N limbs.
+   /// Uses a full Karatsuba product for a0*b0 and recurses for the lower halves of a0*b1 and a1*b0.
+   /// r must not alias a or b.
+   /// </summary>
+   template<size_t N>
+   INLINE static void umulkaratsubalo(const uint64_t* a, const uint64_t* b, uint64_t* r)
+   {
+      if constexpr (N / 2U < CPPCORE_KARATSUBA_THRESHOLD || N % 2U != 0U)
+      {
+         struct TN { uint64_t x[N]; };
+         CppCore::umul(*(const TN*)a, *(const TN*)b, *(TN*)r);
+      }
+      else
+      {
+         constexpr size_t H = N / 2U;
+         uint64_t t[N];
+         uint8_t  c = 0;
+         CppCore::umulkaratsuba<H>(a, b, r);
+         CppCore::umulkaratsubalo<H>(a, b+H, t);
+         CppCore::umulkaratsubalo<H>(a+H, b, t+H);
+         for (size_t i = 0; i < H; i++)
+            CppCore::addcarry64(t[i], t[H+i], t[i], c);
+         c = 0;
+         for (size_t i = 0; i < H; i++)
+            CppCore::addcarry64(r[H+i], t[i], r[H+i], c);
+      }
+   }
+
+   /// <summary>
+   /// Karatsuba Squaring (a*a=r) of N 64-Bit limbs into 2N limbs.
+   /// Splits in halves while at least CPPCORE_KARATSUBA_SQUARE_THRESHOLD limbs, else uses usquareschool().
+   /// r must not alias a.
+   /// </summary>
+   template<size_t N>
+   INLINE static void usquarekaratsuba(const uint64_t* a, uint64_t* r)
+   {
+      if constexpr (N < CPPCORE_KARATSUBA_SQUARE_THRESHOLD || N % 2U != 0U)
+         CppCore::usquareschool<N>(a, r);
+      else
+      {
+         constexpr size_t H = N / 2U;
+         uint64_t d[H], m[N];
+         CppCore::usquarekaratsuba<H>(a, r);
+         CppCore::usquarekaratsuba<H>(a+H, r+N);
+         CppCore::usubabs<H>(a, a+H, d);
+         CppCore::usquarekaratsuba<H>(d, m);
+         CppCore::ukaratsubamid<N>(r, m, false);
+      }
+   }
+
+   /// <summary>
+   /// Multiplication (a*b=r) like umul(), but uses umulkaratsuba() or umulkaratsubalo() 
+   /// for same sized factors of multiples of 64-Bit with a result of double or same size.
+   /// r must not alias a or b.
+   /// </summary>
+   template<typename UINT1, typename UINT2, typename UINT3>
+   INLINE static void umulk(const UINT1& a, const UINT2& b, UINT3& r)
+   {
+   #if defined(CPPCORE_CPU_64BIT)
+      constexpr size_t N = sizeof(UINT1) / 8U;
+      if constexpr (sizeof(UINT1) == sizeof(UINT2) && sizeof(UINT1) % 8U == 0U && sizeof(UINT3) == 2U*sizeof(UINT1))
+         CppCore::umulkaratsuba<N>((const uint64_t*)&a, (const uint64_t*)&b, (uint64_t*)&r);
+      else if constexpr (sizeof(UINT1) == sizeof(UINT2) && sizeof(UINT1) % 8U == 0U && sizeof(UINT3) == sizeof(UINT1))
+         CppCore::umulkaratsubalo<N>((const uint64_t*)&a, (const uint64_t*)&b, (uint64_t*)&r);
+      else
+   #endif
+         CppCore::umul(a, b, r);
+   }
+
+   /// <summary>
+   /// Squaring (a*a=r). Uses usquarekaratsuba() for a multiple of 64-Bit and a result of double size.
+   /// Calculates all bits of r like umul(). r must not alias a.
+   /// </summary>
+   template<typename UINT1, typename UINT2>
+   INLINE static void usquare(const UINT1& a, UINT2& r)
+   {
+   #if defined(CPPCORE_CPU_64BIT)
+      if constexpr (sizeof(UINT1) % 8U == 0U && sizeof(UINT2) == 2U*sizeof(UINT1))
+         CppCore::usquarekaratsuba<sizeof(UINT1) / 8U>((const uint64_t*)&a, (uint64_t*)&r);
+      else
+   #endif
+         CppCore::umulk(a, a, r);
+   }
+
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
    // UNSIGNED DIVISION+MODULO BY CONSTANTS
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3717,7 +3947,7 @@ namespace CppCore
    INLINE static void umulmod(const UINT& a, const UINT& b, const UINT& m, UINT& r, UINT p[3])
    {
       struct UINTX2 { UINT x[2]; };
-      CppCore::umul<UINT, UINT, UINTX2>(a, b, *(UINTX2*)p);
+      CppCore::umulk<UINT, UINT, UINTX2>(a, b, *(UINTX2*)p);
       CppCore::umod<UINTX2, UINT>(r, *(UINTX2*)p, m, (UINTX2*)p);
    }
 
@@ -3814,33 +4044,813 @@ namespace CppCore
    }
 #endif
 
+   /// <summary>
+   /// a*a mod m. Like umulmod(), but uses usquare() for the product. r may alias a.
+   /// </summary>
+   template<typename UINT>
+   INLINE static void usquaremod(const UINT& a, const UINT& m, UINT& r, UINT p[3])
+   {
+      struct UINTX2 { UINT x[2]; };
+      CppCore::usquare<UINT, UINTX2>(a, *(UINTX2*)p);
+      CppCore::umod<UINTX2, UINT>(r, *(UINTX2*)p, m, (UINTX2*)p);
+   }
+
+   /// <summary>
+   /// a*a mod m. Like umulmod(), but uses usquare() for the product. r may alias a.
+   /// </summary>
+   template<typename UINT>
+   INLINE static void usquaremod(const UINT& a, const UINT& m, UINT& r)
+   {
+      CPPCORE_ALIGN_OPTIM(UINT) p[3];
+      CppCore::usquaremod(a, m, r, p);
+   }
+
+   /// <summary>
+   /// Template Specialization for 16-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint16_t& a, const uint16_t& m, uint16_t& r, uint16_t p[3])
+   {
+      CppCore::umulmod16(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Template Specialization for 16-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint16_t& a, const uint16_t& m, uint16_t& r)
+   {
+      CppCore::umulmod16(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Template Specialization for 32-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint32_t& a, const uint32_t& m, uint32_t& r, uint32_t p[3])
+   {
+      CppCore::umulmod32(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Template Specialization for 32-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint32_t& a, const uint32_t& m, uint32_t& r)
+   {
+      CppCore::umulmod32(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Template Specialization for 64-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint64_t& a, const uint64_t& m, uint64_t& r, uint64_t p[3])
+   {
+      CppCore::umulmod64(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Template Specialization for 64-Bit Unsigned.
+   /// </summary>
+   template<> INLINE void usquaremod(const uint64_t& a, const uint64_t& m, uint64_t& r)
+   {
+      CppCore::umulmod64(a, a, m, r);
+   }
+
+   /// <summary>
+   /// Window size in bits for sliding window exponentiation with an exponent of n bits.
+   /// The table of odd powers has 2^(w-1) entries, one window multiplication follows per w+1 bits on average.
+   /// </summary>
+   constexpr INLINE static uint32_t upowmodwindow(const uint32_t n)
+   {
+      return n > 671U ? 6U : n > 239U ? 5U : n > 79U ? 4U : n > 23U ? 3U : n > 7U ? 2U : 1U;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+   // MONTGOMERY
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+   /// <summary>
+   /// Montgomery Context for a*b mod n with odd n and R=2^(sizeof(UINT)*8).
+   /// Precomputes R mod n, R^2 mod n and n'=-n^-1 mod 2^64 once, so that multiplications
+   /// need no multi-limb division anymore. Values must be converted into Montgomery form 
+   /// using to() and back using from(). For any sized integers that are multiples of 64-bit.
+   /// </summary>
+   template<typename UINT>
+   class Montgomery
+   {
+      static_assert(sizeof(UINT) % 8U == 0U);
+
+   public:
+      /// <summary>
+      /// Number of 64-Bit Limbs
+      /// </summary>
+      static constexpr size_t N = sizeof(UINT) / 8U;
+
+   protected:
+      uint64_t n[N];  // odd modulus
+      uint64_t r1[N]; // R mod n (one in Montgomery form)
+      uint64_t r2[N]; // R^2 mod n
+      uint64_t ninv;  // -n^-1 mod 2^64
+
+      /// <summary>
+      /// Stores t-n to r if t with carry word c is larger-equal n, else stores t to r.
+      /// Requires t to be less than 2n.
+      /// </summary>
+      INLINE void reduce(const uint64_t* t, const uint64_t c, uint64_t* r) const
+      {
+         uint64_t s[N];
+         uint8_t  b = 0;
+         for (size_t i = 0; i < N; i++)
+            CppCore::subborrow64(t[i], n[i], s[i], b);
+         const uint64_t mask = 0ULL - (uint64_t)((c == 0ULL) & (b != 0));
+         for (size_t i = 0; i < N; i++)
+            r[i] = (t[i] & mask) | (s[i] & ~mask);
+      }
+
+      /// <summary>
+      /// Montgomery Multiplication (CIOS) on limbs. r may alias a or b.
+      /// Uses umulkaratsuba() and redc() instead from CPPCORE_KARATSUBA_THRESHOLD limbs.
+      /// </summary>
+      INLINE void mul(const uint64_t* a, const uint64_t* b, uint64_t* r) const
+      {
+         if constexpr (N >= CPPCORE_KARATSUBA_THRESHOLD && N % 2U == 0U)
+         {
+            // product in O(n^1.58) and separate reduction
+            uint64_t p[2*N];
+            CppCore::umulkaratsuba<N>(a, b, p);
+            this->redc(p, r);
+            return;
+         }
+         uint64_t t[N+2];
+         uint64_t tl, th, k, q;
+         uint8_t  c;
+         for (size_t i = 0; i < N+2; i++)
+            t[i] = 0ULL;
+         for (size_t i = 0; i < N; i++)
+         {
+            // t += a*b[i]
+            const uint64_t bi = b[i];
+            k = 0ULL;
+            for (size_t j = 0; j < N; j++)
+            {
+               CppCore::umul128(a[j], bi, tl, th);  // mulx
+               c = 0;
+               CppCore::addcarry64(tl, t[j], tl, c); // add
+               CppCore::addcarry64(th, 0ULL, th, c); // adc
+               c = 0;
+               CppCore::addcarry64(tl, k, t[j], c);  // add
+               CppCore::addcarry64(th, 0ULL, k, c);  // adc
+            }
+            c = 0;
+            CppCore::addcarry64(t[N], k, t[N], c);
+            t[N+1] = c;
+
+            // t = (t+q*n)/2^64 with q chosen so lowest limb becomes zero
+            q = t[0] * ninv;
+            CppCore::umul128(q, n[0], tl, th);
+            c = 0;
+            CppCore::addcarry64(tl, t[0], tl, c);
+            CppCore::addcarry64(th, 0ULL, k, c);
+            for (size_t j = 1; j < N; j++)
+            {
+               CppCore::umul128(q, n[j], tl, th);     // mulx
+               c = 0;
+               CppCore::addcarry64(tl, t[j], tl, c);  // add
+               CppCore::addcarry64(th, 0ULL, th, c);  // adc
+               c = 0;
+               CppCore::addcarry64(tl, k, t[j-1], c); // add
+               CppCore::addcarry64(th, 0ULL, k, c);   // adc
+            }
+            c = 0;
+            CppCore::addcarry64(t[N], k, t[N-1], c);
+            t[N] = t[N+1] + c;
+         }
+         this->reduce(t, t[N], r);
+      }
+
+      /// <summary>
+      /// Montgomery Reduction (REDC) of the 2N limbs product t to r. Destroys t.
+      /// </summary>
+      INLINE void redc(uint64_t* t, uint64_t* r) const
+      {
+         uint64_t tl, th, k, q, h;
+         uint8_t  c;
+
+         // reduce limb by limb, carry out of t[i+N] is deferred to next round
+         h = 0ULL;
+         for (size_t i = 0; i < N; i++)
+         {
+            q = t[i] * ninv;
+            k = 0ULL;
+            for (size_t j = 0; j < N; j++)
+            {
+               CppCore::umul128(q, n[j], tl, th);
+               c = 0;
+               CppCore::addcarry64(tl, t[i+j], tl, c);
+               CppCore::addcarry64(th, 0ULL, th, c);
+               c = 0;
+               CppCore::addcarry64(tl, k, t[i+j], c);
+               CppCore::addcarry64(th, 0ULL, k, c);
+            }
+            c = (uint8_t)h;
+            CppCore::addcarry64(t[i+N], k, t[i+N], c);
+            h = c;
+         }
+         this->reduce(&t[N], h, r);
+      }
+
+      /// <summary>
+      /// Montgomery Squaring (SOS) on limbs. Squares with usquarekaratsuba(). r may alias a.
+      /// </summary>
+      INLINE void square(const uint64_t* a, uint64_t* r) const
+      {
+         uint64_t t[2*N];
+         CppCore::usquarekaratsuba<N>(a, t);
+         this->redc(t, r);
+      }
+
+      /// <summary>
+      /// Converts a from Montgomery form on limbs.
+      /// </summary>
+      INLINE void from(const uint64_t* a, uint64_t* r) const
+      {
+         uint64_t one[N];
+         one[0] = 1ULL;
+         for (size_t i = 1; i < N; i++)
+            one[i] = 0ULL;
+         this->mul(a, one, r);
+      }
+
+   public:
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE Montgomery() { }
+
+      /// <summary>
+      /// Constructor for odd modulus m.
+      /// </summary>
+      INLINE Montgomery(const UINT& m) { reset(m); }
+
+      /// <summary>
+      /// Precomputes the constants for odd modulus m.
+      /// Uses the division based umod() and umulmod() once.
+      /// </summary>
+      INLINE void reset(const UINT& m)
+      {
+         struct UINTX2 { UINT x[2]; };
+         CPPCORE_ALIGN_OPTIM(UINTX2) t;
+         CPPCORE_ALIGN_OPTIM(UINTX2) mem[2];
+         CPPCORE_ALIGN_OPTIM(UINT) x, y;
+         const uint64_t one = 1ULL;
+
+         assert(CppCore::bittest(m, 0));
+         ::memcpy(n, &m, sizeof(n));
+
+         // n' from newton iteration, n0 is its own inverse for lowest 3 bits
+         uint64_t v = n[0];
+         CPPCORE_UNROLL
+         for (size_t i = 0; i < 5U; i++)
+            v *= 2ULL - n[0] * v;
+         ninv = 0ULL - v;
+
+         // R mod n and R^2 mod n
+         CppCore::clear(t);
+         ::memcpy((char*)&t + sizeof(UINT), &one, sizeof(one));
+         CppCore::umod<UINTX2, UINT>(x, t, m, mem);
+         CppCore::umulmod(x, x, m, y);
+         ::memcpy(r1, &x, sizeof(r1));
+         ::memcpy(r2, &y, sizeof(r2));
+      }
+
+      /// <summary>
+      /// Montgomery Multiplication (CIOS) r=a*b*R^-1 mod n.
+      /// Requires a and b less than n, e.g. both in Montgomery form. r may alias a or b.
+      /// </summary>
+      INLINE void mul(const UINT& a, const UINT& b, UINT& r) const
+      {
+         uint64_t x[N], y[N];
+         ::memcpy(x, &a, sizeof(x));
+         ::memcpy(y, &b, sizeof(y));
+         this->mul(x, y, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// Montgomery Squaring (SOS) r=a*a*R^-1 mod n. Requires a less than n. r may alias a.
+      /// </summary>
+      INLINE void square(const UINT& a, UINT& r) const
+      {
+         uint64_t x[N];
+         ::memcpy(x, &a, sizeof(x));
+         this->square(x, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// Converts a into Montgomery form r=a*R mod n. Requires a less than R.
+      /// </summary>
+      INLINE void to(const UINT& a, UINT& r) const
+      {
+         uint64_t x[N];
+         ::memcpy(x, &a, sizeof(x));
+         this->mul(x, r2, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// Converts a from Montgomery form r=a*R^-1 mod n.
+      /// </summary>
+      INLINE void from(const UINT& a, UINT& r) const
+      {
+         uint64_t x[N];
+         ::memcpy(x, &a, sizeof(x));
+         this->from(x, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// r=a^b mod n using Montgomery squaring and multiplication.
+      /// Scans b from left to right in sliding windows of upowmodwindow() bits using a table of odd powers.
+      /// Input a and output r are in normal form.
+      /// </summary>
+      INLINE void pow(const UINT& a, const UINT& b, UINT& r) const
+      {
+         constexpr uint32_t WMAX = CppCore::upowmodwindow((uint32_t)(N * 64U));
+         uint64_t x[N], y[N], e[N];
+         uint64_t tbl[1U << (WMAX-1U)][N];
+         ::memcpy(e, &b, sizeof(e));
+         uint32_t bits = (uint32_t)N;
+         while (bits && !e[bits-1U]) bits--;
+         if (bits == 0U) CPPCORE_UNLIKELY {
+            this->from(r1, x);
+            ::memcpy((void*)&r, x, sizeof(x));
+            return;
+         }
+         bits = bits * 64U - CppCore::lzcnt64(e[bits-1U]);
+         const uint32_t W = CppCore::upowmodwindow(bits);
+
+         // odd powers a^1, a^3, ..., a^(2^W-1) in Montgomery form
+         ::memcpy(x, &a, sizeof(x));
+         this->mul(x, r2, tbl[0]);
+         if (W > 1U)
+         {
+            this->square(tbl[0], x);
+            for (uint32_t j = 1U; j < (1U << (W-1U)); j++)
+               this->mul(tbl[j-1U], x, tbl[j]);
+         }
+
+         // highest bit is set, so first window initializes y
+         int32_t i = (int32_t)bits - 1;
+         bool first = true;
+         while (i >= 0)
+         {
+            if (!((e[i >> 6] >> (i & 63)) & 1U))
+            {
+               this->square(y, y);
+               i--;
+               continue;
+            }
+            // longest window ending in a set bit
+            int32_t j = MAX(i - (int32_t)W + 1, 0);
+            while (!((e[j >> 6] >> (j & 63)) & 1U))
+               j++;
+            uint32_t v = 0U;
+            for (int32_t l = i; l >= j; l--)
+               v = (v << 1) | (uint32_t)((e[l >> 6] >> (l & 63)) & 1U);
+            if (first)
+            {
+               ::memcpy(y, tbl[v >> 1], sizeof(y));
+               first = false;
+            }
+            else
+            {
+               for (int32_t l = i; l >= j; l--)
+                  this->square(y, y);
+               this->mul(y, tbl[v >> 1], y);
+            }
+            i = j - 1;
+         }
+         this->from(y, y);
+         ::memcpy((void*)&r, y, sizeof(y));
+      }
+   };
+
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+   // BARRETT
+   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+   /// <summary>
+   /// Barrett Context for a*b mod n with any n larger than zero, including even n.
+   /// Precomputes mu=floor(b^2k/n) once, with b=2^64 and k the number of used 64-Bit limbs of n.
+   /// After that a reduction takes two half multiplications and at most three subtractions instead
+   /// of a multi-limb division. Unlike Montgomery, values stay in normal form. For any sized integers
+   /// that are multiples of 64-bit.
+   /// </summary>
+   template<typename UINT>
+   class Barrett
+   {
+      static_assert(sizeof(UINT) % 8U == 0U);
+
+   public:
+      /// <summary>
+      /// Number of 64-Bit Limbs
+      /// </summary>
+      static constexpr size_t N = sizeof(UINT) / 8U;
+
+   protected:
+      uint64_t n[N];    // modulus
+      uint64_t mu[N+2]; // floor(b^2k/n), has k+2 limbs only for n=b^(k-1)
+      size_t   k;       // used limbs of n
+
+      /// <summary>
+      /// Barrett Reduction of the 2N limbs x to r. Requires x less than b^2k, e.g. a product of two values less than n.
+      /// FULL is for k=N, which lets the compiler unroll all loops.
+      /// </summary>
+      template<bool FULL>
+      INLINE void reduce(const uint64_t* x, uint64_t* r) const
+      {
+         if constexpr (N == 1U)
+         {
+            // q=floor(x*mu/b^2) without the lowest partial product, less than b and at most three too small
+            uint64_t l0, h0, l1, h1, l2, h2, q, t0, t1;
+            uint8_t  c = 0;
+            CppCore::umul128(x[0], mu[1], l0, h0);
+            CppCore::umul128(x[1], mu[0], l1, h1);
+            CppCore::umul128(x[1], mu[1], l2, h2);
+            CppCore::addcarry64(l0, l1, l0, c);
+            q = h0 + h1 + l2 + c + (x[0] & (0ULL - mu[2]));
+
+            // x-q*n is less than 4n
+            CppCore::umul128(q, n[0], t0, t1);
+            c = 0;
+            CppCore::subborrow64(x[0], t0, t0, c);
+            CppCore::subborrow64(x[1], t1, t1, c);
+            while (t1 || t0 >= n[0])
+            {
+               c = 0;
+               CppCore::subborrow64(t0, n[0], t0, c);
+               CppCore::subborrow64(t1, 0ULL, t1, c);
+            }
+            r[0] = t0;
+            return;
+         }
+         const size_t K = FULL ? N : k;
+         uint64_t p[2*N+3];
+         uint64_t t[N+1];
+         uint64_t s[N+1];
+         uint64_t tl, th, h;
+         uint8_t  c;
+
+         // p=floor(x/b^(k-1))*mu, skipping the partial products below limb k-1
+         // lowers the estimated quotient by at most one
+         p[K-1] = p[K] = p[K+1] = 0ULL;
+         for (size_t i = 0; i <= K; i++)
+         {
+            const uint64_t xi = x[K-1+i];
+            h = 0ULL;
+            for (size_t j = (i < K ? K-1-i : 0); j < K+2; j++)
+            {
+               CppCore::umul128(xi, mu[j], tl, th);
+               c = 0;
+               CppCore::addcarry64(tl, p[i+j], tl, c);
+               CppCore::addcarry64(th, 0ULL, th, c);
+               c = 0;
+               CppCore::addcarry64(tl, h, p[i+j], c);
+               CppCore::addcarry64(th, 0ULL, h, c);
+            }
+            p[i+K+2] = h;
+         }
+
+         // t=(q*n) mod b^(k+1) for the estimated quotient q=floor(p/b^(k+1))
+         const uint64_t* q = &p[K+1];
+         for (size_t i = 0; i <= K; i++)
+            t[i] = 0ULL;
+         for (size_t i = 0; i <= K; i++)
+         {
+            const uint64_t qi = q[i];
+            const size_t   J  = MIN(K, K+1-i);
+            h = 0ULL;
+            for (size_t j = 0; j < J; j++)
+            {
+               CppCore::umul128(qi, n[j], tl, th);
+               c = 0;
+               CppCore::addcarry64(tl, t[i+j], tl, c);
+               CppCore::addcarry64(th, 0ULL, th, c);
+               c = 0;
+               CppCore::addcarry64(tl, h, t[i+j], c);
+               CppCore::addcarry64(th, 0ULL, h, c);
+            }
+            if (i+J <= K)
+               t[i+J] += h;
+         }
+
+         // t=(x-q*n) mod b^(k+1) is less than 4n
+         c = 0;
+         for (size_t i = 0; i <= K; i++)
+            CppCore::subborrow64(x[i], t[i], t[i], c);
+
+         // at most three subtractions of n
+         for (size_t l = 0; l < 3U; l++)
+         {
+            c = 0;
+            for (size_t i = 0; i < K; i++)
+               CppCore::subborrow64(t[i], n[i], s[i], c);
+            CppCore::subborrow64(t[K], 0ULL, s[K], c);
+            if (c)
+               break;
+            for (size_t i = 0; i <= K; i++)
+               t[i] = s[i];
+         }
+         for (size_t i = 0; i < K; i++)
+            r[i] = t[i];
+         for (size_t i = K; i < N; i++)
+            r[i] = 0ULL;
+      }
+
+      /// <summary>
+      /// Barrett Reduction of the 2N limbs x to r. Requires x less than b^2k.
+      /// </summary>
+      INLINE void reduce(const uint64_t* x, uint64_t* r) const
+      {
+         if (k == N) CPPCORE_LIKELY
+            this->reduce<true>(x, r);
+         else
+            this->reduce<false>(x, r);
+      }
+
+      /// <summary>
+      /// Multiplication with Barrett Reduction on limbs. Multiplies with umulkaratsuba().
+      /// Requires a and b less than n. r may alias a or b.
+      /// </summary>
+      INLINE void mul(const uint64_t* a, const uint64_t* b, uint64_t* r) const
+      {
+         uint64_t p[2*N];
+         if constexpr (N == 1U)
+            CppCore::umul128(a[0], b[0], p[0], p[1]);
+         else
+            CppCore::umulkaratsuba<N>(a, b, p);
+         this->reduce(p, r);
+      }
+
+      /// <summary>
+      /// Squaring with Barrett Reduction on limbs. Squares with usquarekaratsuba(). Requires a less than n. r may alias a.
+      /// </summary>
+      INLINE void square(const uint64_t* a, uint64_t* r) const
+      {
+         uint64_t p[2*N];
+         if constexpr (N == 1U)
+            CppCore::umul128(a[0], a[0], p[0], p[1]);
+         else
+            CppCore::usquarekaratsuba<N>(a, p);
+         this->reduce(p, r);
+      }
+
+   public:
+      /// <summary>
+      /// Empty Constructor. Call reset() before using the instance!
+      /// </summary>
+      INLINE Barrett() { }
+
+      /// <summary>
+      /// Constructor for modulus m larger than zero.
+      /// </summary>
+      INLINE Barrett(const UINT& m) { reset(m); }
+
+      /// <summary>
+      /// Precomputes mu for modulus m larger than zero.
+      /// Uses the division based udivmod() once.
+      /// </summary>
+      INLINE void reset(const UINT& m)
+      {
+         struct UINTX2 { uint64_t x[2*N+2]; };
+         CPPCORE_ALIGN_OPTIM(UINTX2) t, q;
+         CPPCORE_ALIGN_OPTIM(UINTX2) mem[2];
+         CPPCORE_ALIGN_OPTIM(UINT) r;
+
+         assert(!CppCore::testzero(m));
+         ::memcpy(n, &m, sizeof(n));
+         k = N;
+         while (k > 1U && !n[k-1U])
+            k--;
+
+         // mu=floor(b^2k/n)
+         CppCore::clear(t);
+         t.x[2*k] = 1ULL;
+         CppCore::udivmod(q, r, t, m, mem);
+         ::memcpy(mu, q.x, sizeof(mu));
+      }
+
+      /// <summary>
+      /// r=a*b mod n. Requires a and b less than n. r may alias a or b.
+      /// </summary>
+      INLINE void mul(const UINT& a, const UINT& b, UINT& r) const
+      {
+         uint64_t x[N], y[N];
+         ::memcpy(x, &a, sizeof(x));
+         ::memcpy(y, &b, sizeof(y));
+         this->mul(x, y, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// r=a*a mod n. Requires a less than n. r may alias a.
+      /// </summary>
+      INLINE void square(const UINT& a, UINT& r) const
+      {
+         uint64_t x[N];
+         ::memcpy(x, &a, sizeof(x));
+         this->square(x, x);
+         ::memcpy((void*)&r, x, sizeof(x));
+      }
+
+      /// <summary>
+      /// r=a mod n for any a. Uses umod() instead if a can be larger-equal b^2k.
+      /// </summary>
+      INLINE void mod(const UINT& a, UINT& r) const
+      {
+         if (N <= 2U*k) CPPCORE_LIKELY
+         {
+            uint64_t x[2*N];
+            ::memcpy(x, &a, sizeof(UINT));
+            for (size_t i = N; i < 2*N; i++)
+               x[i] = 0ULL;
+            this->reduce(x, x);
+            ::memcpy((void*)&r, x, sizeof(UINT));
+         }
+         else
+         {
+            CPPCORE_ALIGN_OPTIM(UINT) m;
+            ::memcpy((void*)&m, n, sizeof(UINT));
+            CppCore::umod(r, a, m);
+         }
+      }
+
+      /// <summary>
+      /// r=a^b mod n using Barrett squaring and multiplication.
+      /// Scans b from left to right in sliding windows of upowmodwindow() bits using a table of odd powers.
+      /// </summary>
+      INLINE void pow(const UINT& a, const UINT& b, UINT& r) const
+      {
+         constexpr uint32_t WMAX = CppCore::upowmodwindow((uint32_t)(N * 64U));
+         uint64_t x[N], y[N], e[N];
+         uint64_t tbl[1U << (WMAX-1U)][N];
+         ::memcpy(e, &b, sizeof(e));
+         uint32_t bits = (uint32_t)N;
+         while (bits && !e[bits-1U]) bits--;
+         if (bits == 0U) CPPCORE_UNLIKELY {
+            // one mod n
+            for (size_t i = 0; i < N; i++)
+               y[i] = 0ULL;
+            y[0] = (k > 1U || n[0] > 1U) ? 1ULL : 0ULL;
+            ::memcpy((void*)&r, y, sizeof(y));
+            return;
+         }
+         bits = bits * 64U - CppCore::lzcnt64(e[bits-1U]);
+         const uint32_t W = CppCore::upowmodwindow(bits);
+
+         // odd powers a^1, a^3, ..., a^(2^W-1) mod n
+         CPPCORE_ALIGN_OPTIM(UINT) t;
+         this->mod(a, t);
+         ::memcpy(tbl[0], &t, sizeof(tbl[0]));
+         if (W > 1U)
+         {
+            this->square(tbl[0], x);
+            for (uint32_t j = 1U; j < (1U << (W-1U)); j++)
+               this->mul(tbl[j-1U], x, tbl[j]);
+         }
+
+         // highest bit is set, so first window initializes y
+         int32_t i = (int32_t)bits - 1;
+         bool first = true;
+         while (i >= 0)
+         {
+            if (!((e[i >> 6] >> (i & 63)) & 1U))
+            {
+               this->square(y, y);
+               i--;
+               continue;
+            }
+            // longest window ending in a set bit
+            int32_t j = MAX(i - (int32_t)W + 1, 0);
+            while (!((e[j >> 6] >> (j & 63)) & 1U))
+               j++;
+            uint32_t v = 0U;
+            for (int32_t l = i; l >= j; l--)
+               v = (v << 1) | (uint32_t)((e[l >> 6] >> (l & 63)) & 1U);
+            if (first)
+            {
+               ::memcpy(y, tbl[v >> 1], sizeof(y));
+               first = false;
+            }
+            else
+            {
+               for (int32_t l = i; l >= j; l--)
+                  this->square(y, y);
+               this->mul(y, tbl[v >> 1], y);
+            }
+            i = j - 1;
+         }
+         ::memcpy((void*)&r, y, sizeof(y));
+      }
+   };
+
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
    // POWMOD
    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
    
    /// <summary>
-   /// a^b mod m
+   /// a^b mod m using precomputed Montgomery context for odd m.
+   /// </summary>
+   template<typename UINT>
+   INLINE static void upowmod(const UINT& a, const UINT& b, const Montgomery<UINT>& m, UINT& r)
+   {
+      m.pow(a, b, r);
+   }
+
+   /// <summary>
+   /// a^b mod m using precomputed Barrett context for any m.
+   /// </summary>
+   template<typename UINT>
+   INLINE static void upowmod(const UINT& a, const UINT& b, const Barrett<UINT>& m, UINT& r)
+   {
+      m.pow(a, b, r);
+   }
+
+   /// <summary>
+   /// a^b mod m. Uses Montgomery multiplication for odd m and Barrett reduction for even m if UINT is a multiple of 64-bit.
+   /// Else scans b from left to right in sliding windows of upowmodwindow() bits using a table of odd powers.
    /// </summary>
    template<typename UINT>
    INLINE static void upowmod(UINT& a, const UINT& b, const UINT& m, UINT& r, UINT t[3])
    {
       assert((&a != &r) && (&b != &r) && (&m != &r));
       assert(!CppCore::testzero(m));
+      if constexpr (sizeof(UINT) % 8U == 0U)
+      {
+         if (CppCore::bittest(m, 0))
+         {
+            const Montgomery<UINT> mt(m);
+            mt.pow(a, b, r);
+            return;
+         }
+         else
+         {
+            const Barrett<UINT> br(m);
+            br.pow(a, b, r);
+            return;
+         }
+      }
       CppCore::clear(r);
       constexpr auto NUMBITS = sizeof(UINT)*8U;
+      constexpr uint32_t WMAX = CppCore::upowmodwindow((uint32_t)NUMBITS);
       const auto LZB = CppCore::lzcnt(b);
       if (LZB == NUMBITS) CPPCORE_UNLIKELY {
          if (NUMBITS-CppCore::lzcnt(m) != 1U) CPPCORE_LIKELY
             *(uint32_t*)&r = 1U;
          return;
       }
+      const uint32_t HIDX = (uint32_t)(NUMBITS-LZB);
+      const uint32_t W = CppCore::upowmodwindow(HIDX);
+
+      // odd powers a^1, a^3, ..., a^(2^W-1) mod m, a is reduced by multiplying with one
+      CPPCORE_ALIGN_OPTIM(UINT) tbl[1U << (WMAX-1U)];
       *(uint32_t*)&r = 1U;
-      const uint32_t HIDX = NUMBITS-LZB;
-      for (uint32_t i = 0; i < HIDX; i++)
+      CppCore::umulmod(a, r, m, tbl[0], t);
+      if (W > 1U)
+      {
+         CppCore::usquaremod(tbl[0], m, a, t);
+         for (uint32_t j = 1U; j < (1U << (W-1U)); j++)
+            CppCore::umulmod(tbl[j-1U], a, m, tbl[j], t);
+      }
+
+      // highest bit is set, so first window initializes r
+      int32_t i = (int32_t)HIDX - 1;
+      bool first = true;
+      while (i >= 0)
       {
-         if (CppCore::bittest(b, i))
-            CppCore::umulmod(r, a, m, r, t);
-         CppCore::umulmod(a, a, m, a, t); //TODO: usquaremod
+         if (!CppCore::bittest(b, (uint32_t)i))
+         {
+            CppCore::usquaremod(r, m, r, t);
+            i--;
+            continue;
+         }
+         // longest window ending in a set bit
+         int32_t j = MAX(i - (int32_t)W + 1, 0);
+         while (!CppCore::bittest(b, (uint32_t)j))
+            j++;
+         uint32_t v = 0U;
+         for (int32_t l = i; l >= j; l--)
+            v = (v << 1) | (uint32_t)CppCore::bittest(b, (uint32_t)l);
+         if (first)
+         {
+            CppCore::clone(r, tbl[v >> 1]);
+            first = false;
+         }
+         else
+         {
+            for (int32_t l = i; l >= j; l--)
+               CppCore::usquaremod(r, m, r, t);
+            CppCore::umulmod(r, tbl[v >> 1], m, r, t);
+         }
+         i = j - 1;
       }
    }
 
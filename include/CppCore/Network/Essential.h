@@ -14,7 +14,24 @@
 // Settings for NetServer/Session
 
 #ifndef CPPCORE_NETSERVER_MAXCLIENTS
-#define CPPCORE_NETSERVER_MAXCLIENTS  256 // maximum supported clients/sessions , if overwritten you must also adjust fixed size constructor
+#define CPPCORE_NETSERVER_MAXCLIENTS  256 // maximum supported clients/sessions (32, 64, ..., 4096)
+#endif
+#ifndef CPPCORE_NETSERVER_REACTORS
+#define CPPCORE_NETSERVER_REACTORS  1 // listening sockets/poll loops sharing the port with SO_REUSEPORT, sessions are split evenly
+#endif
+#define CPPCORE_NETSERVER_SESSIONSPERREACTOR  (CPPCORE_NETSERVER_MAXCLIENTS / CPPCORE_NETSERVER_REACTORS) // sessions owned by each reactor (derived, size of its session pools)
+#ifndef CPPCORE_NETSERVER_EPOLL
+#if defined(CPPCORE_OS_LINUX) || defined(CPPCORE_OS_ANDROID)
+#define CPPCORE_NETSERVER_EPOLL  1 // use edge-triggered epoll instead of poll for tcp sessions
+#else
+#define CPPCORE_NETSERVER_EPOLL  0 // epoll not available, use poll for tcp sessions
+#endif
+#endif
+#ifndef CPPCORE_NETSERVER_EPOLL_MAXEVENTS
+#define CPPCORE_NETSERVER_EPOLL_MAXEVENTS  256 // maximum events returned by a single epoll_wait()
+#endif
+#ifndef CPPCORE_NETSERVER_TIMEOUTCHECK
+#define CPPCORE_NETSERVER_TIMEOUTCHECK  250 // milliseconds between receive timeout checks of all sessions (epoll only)
 #endif
 #ifndef CPPCORE_NETSERVER_SENDSTUCKDISCTIME
 #define CPPCORE_NETSERVER_SENDSTUCKDISCTIME  3000 // milliseconds until a client gets kicked if socket does not recover from WSAEWOULDBLOCK
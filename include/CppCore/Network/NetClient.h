@@ -15,6 +15,8 @@ namespace CppCore
 {
    /// <summary>
    /// NetClient
+   /// The default UDP pool has no magazines, all of its buffers can
+   /// be queued for sending by the application thread at once.
    /// </summary>
    template<
       typename TMSGTCP, 
@@ -44,39 +46,66 @@ namespace CppCore
       TQUEUEUDPOUT mMessagesUdp;
 
       /// <summary>
-      /// 
+      /// Sends all enqueued udp messages.
+      /// Up to CPPCORE_SOCKET_DGRAMBATCH of them with one sendtov() call.
       /// </summary>
       INLINE void sendSub() override
       {
-         // UDP
-         TMSGUDP* msg;
-         while (mMessagesUdp.popFront(msg))
+         // size of message header
+         const size_t LENHEAD = TMSGUDP::getHeaderSize();
+
+         // batch of udp messages and their datagrams
+         TMSGUDP* msgs[CPPCORE_SOCKET_DGRAMBATCH];
+         Socket::Op::Datagram dgrams[CPPCORE_SOCKET_DGRAMBATCH];
+
+         while (true)
          {
-            msg->setLengthRead(0);
-            onSendFinalizeUdp(*msg);
+            int n = 0;
+            TMSGUDP* msg;
+            while (n < CPPCORE_SOCKET_DGRAMBATCH && mMessagesUdp.popFront(msg))
+            {
+               msg->setLengthRead(0);
+               onSendFinalizeUdp(*msg);
+
+               // only send if at least header length
+               const size_t LENMSG = msg->getLength();
+               if (LENMSG < LENHEAD)
+               {
+                  this->logWarn("Discarded udp message below headersize");
+                  mPoolMessageUdp.pushBack(msg);
+                  continue;
+               }
+
+               // the whole udp datagram to the server
+               Socket::Op::Datagram& d = dgrams[n];
+               d.buf = msg->getPtr();
+               d.len = (int)LENMSG;
+               d.addr = this->mNetLink.getAddress();
+               d.addrlen = sizeof(d.addr);
+               msgs[n++] = msg;
+            }
 
-            // check minimal length
-            const size_t LENHEAD = TMSGUDP::getHeaderSize();
-            const size_t LENMSG = msg->getLength();
+            if (!n)
+               return;
 
-            // only send if at least header length
-            if (LENMSG >= LENHEAD)
+            // send the batch, continue after the first failed one
+            int sent = 0;
+            while (sent < n)
             {
-               // send the whole udp datagram
-               const int rc = mSocketUdp.sendto(
-                  msg->getPtr(), (int)LENMSG, 0, 
-                  (sockaddr*)&this->mNetLink.getAddress(),
-                  sizeof(this->mNetLink.getAddress()));
-
-               // something went wrong
-               if (rc != (int)LENMSG)
+               const int rc = mSocketUdp.sendtov(&dgrams[sent], n - sent);
+               if (rc > 0)
+                  sent += rc;
+               else
+               {
+                  // something went wrong, drop this one
                   this->logWarn("Failed to send udp message");
+                  sent++;
+               }
             }
-            else
-               this->logWarn("Discarded udp message below headersize");
 
-            // push msg back to free ones
-            mPoolMessageUdp.pushBack(msg);
+            // push msgs back to free ones
+            for (int i = 0; i < n; i++)
+               mPoolMessageUdp.pushBack(msgs[i]);
          }
       }
 
@@ -8,14 +8,16 @@ namespace CppCore
 {
    /// <summary>
    /// NetServer
+   /// The default UDP pool has no magazines, datagrams are received
+   /// into buffers that worker threads handle and free.
    /// </summary>
    template<
       typename TMSGTCP, 
       typename TMSGUDP, 
       typename TSHAREDDATA  = NetSessionSharedData<TMSGTCP, TMSGUDP>,
       typename TSESSION     = NetSession<TMSGTCP, TMSGUDP, TSHAREDDATA>,
-      typename TPOOLSESSION = TcpSessionPool<TSESSION, CPPCORE_NETSERVER_MAXCLIENTS>,
-      typename TPOLLSESSION = Array::Fix::ST<TSESSION*, CPPCORE_NETSERVER_MAXCLIENTS>,
+      typename TPOOLSESSION = TcpSessionPool<TSESSION, CPPCORE_NETSERVER_SESSIONSPERREACTOR>,
+      typename TPOLLSESSION = Array::Fix::ST<TSESSION*, CPPCORE_NETSERVER_SESSIONSPERREACTOR>,
       typename TPOOLUDP     = Pool::Fix::MT<TMSGUDP, CPPCORE_NETSERVER_BUFFERCOUNT_UDP>>
    class NetServer : public TcpServer<TMSGTCP, TSHAREDDATA, TSESSION, TPOOLSESSION, TPOLLSESSION>
    {
@@ -65,69 +67,89 @@ namespace CppCore
          // size of message header
          const size_t LENHEAD = TMSGUDP::getHeaderSize();
 
-         // current udp message
-         TMSGUDP* msg = NULL;
+         // udp messagebuffers for a batch and their datagram slots
+         TMSGUDP* msgs[CPPCORE_SOCKET_DGRAMBATCH];
+         Socket::Op::Datagram dgrams[CPPCORE_SOCKET_DGRAMBATCH];
+         int nummsgs = 0;
 
-         // looper on pending udp datagrams
+         // looper on batches of pending udp datagrams
          while (true)
          {
-            sockaddr_in6 senderaddr;
-            socklen_t lplen = sizeof(senderaddr);
- 
-            // continue OR try to get a new udp messagebuffer
-            // if none is available just return (TODO: kick random client?)
-            if (!msg && !this->mSharedData.mPoolMessageUdp.popBack(msg))
+            // fill up with udp messagebuffers, keeping unused ones of last batch
+            // if none is available just stop (TODO: kick random client?)
+            while (nummsgs < CPPCORE_SOCKET_DGRAMBATCH &&
+               this->mSharedData.mPoolMessageUdp.popBack(msgs[nummsgs]))
+               nummsgs++;
+
+            if (!nummsgs)
                return;
 
-            // try to read next udp datagram
             // unlike tcp, udp is 1 udp = 1 message
             // so it's always written to data start
-            const int rc = mSocketUdp.recvfrom(
-               msg->getPtr(), (int)msg->getSize(), 0, (sockaddr*)&senderaddr, &lplen);
+            for (int i = 0; i < nummsgs; i++)
+            {
+               dgrams[i].buf = msgs[i]->getPtr();
+               dgrams[i].len = (int)msgs[i]->getSize();
+            }
+
+            // try to read next udp datagrams
+            const int ASKED = nummsgs;
+            const int rc = mSocketUdp.recvfromv(dgrams, ASKED);
+
+            // no more udp datagram was read
+            if (rc <= 0)
+            {
+               // due to an error
+               if (rc < 0 && !Socket::Op::isLastErrorBlock())
+                  this->logDebug("UDP read socket error");
+               break;
+            }
 
-            // a new datagram was read
-            if (rc > 0)
+            // process the datagrams, keep buffers the sessions didn't take
+            int kept = 0;
+            for (int i = 0; i < rc; i++)
             {
+               TMSGUDP* msg = msgs[i];
+               const size_t LENMSG = (size_t)dgrams[i].len;
+
                // too short, not even a header
-               if ((size_t)rc < LENHEAD)
+               if (LENMSG < LENHEAD)
                {
                   this->logDebug("UDP with less than header length");
-                  continue; // reuse msg next loop
+                  msgs[kept++] = msg;
+                  continue;
                }
 
                // set new length of messagebuffer
-               msg->setLength((size_t)rc);
+               msg->setLength(LENMSG);
 
                // invalid session id
                const size_t SESSIONIDX = msg->getHeaderSessionIndex();
                if (SESSIONIDX >= CPPCORE_NETSERVER_MAXCLIENTS)
                {
                   this->logDebug("UDP Invalid SessionIndex");
-                  continue; // reuse msg next loop
+                  msgs[kept++] = msg;
+                  continue;
                }
 
-               // receive udp into session (if true reset msg, otherwise reuse)
-               if (this->mSessions[SESSIONIDX].recvUdp(*msg, senderaddr))
-                  msg = NULL;
+               // receive udp into session (if false reuse msg)
+               if (!this->mSessions[SESSIONIDX].recvUdp(*msg, dgrams[i].addr))
+                  msgs[kept++] = msg;
             }
 
-            // no more udp datagram was read
-            else
-            {
-               // due to an error
-               if (rc < 0)
-               {
-                  if (!Socket::Op::isLastErrorBlock())
-                     this->logDebug("UDP read socket error");
-               }
-
-               // add unused buffer to free ones again
-               this->mSharedData.mPoolMessageUdp.pushBack(msg);
+            // move the unused buffers to the front
+            for (int i = rc; i < nummsgs; i++)
+               msgs[kept++] = msgs[i];
+            nummsgs = kept;
 
-               // break out of udp read loop
+            // read less than asked for, nothing more pending
+            if (rc < ASKED)
                break;
-            }
          }
+
+         // add unused buffers to free ones again
+         for (int i = 0; i < nummsgs; i++)
+            this->mSharedData.mPoolMessageUdp.pushBack(msgs[i]);
       }
 
       ///////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,7 +194,7 @@ namespace CppCore
              this->logError("Failed to disable IPV6_V6ONLY on udp socket.");
 
          // bind udp socket
-         if (SOCKET_ERROR == mSocketUdp.bind((sockaddr*)&this->mSocketTcp.getAddress(), sizeof(this->mSocketTcp.getAddress())))
+         if (SOCKET_ERROR == mSocketUdp.bind((sockaddr*)&this->getSocketTcp().getAddress(), sizeof(this->getSocketTcp().getAddress())))
              this->logError("Failed to bind udp socket.");
 
          // schedule udp polling
@@ -8,6 +8,8 @@ namespace CppCore
 {
    /// <summary>
    /// Shared Data between all sessions and server.
+   /// The default UDP pool has no magazines, the sessions on all
+   /// worker threads can use all of its buffers.
    /// </summary>
    template<
       typename TMSGTCP  = TcpLinkMessage<>, 
@@ -4,6 +4,10 @@
 
 #ifndef CPPCORE_NO_SOCKET
 
+#ifndef CPPCORE_SOCKET_DGRAMBATCH
+#define CPPCORE_SOCKET_DGRAMBATCH 64 // max. datagrams per recvfromv() or sendtov() syscall
+#endif
+
 namespace CppCore
 {
    /// <summary>
@@ -179,6 +183,137 @@ namespace CppCore
             return ::send(s, buf, len, flags);
          }
 
+         /// <summary>
+         /// Datagram for recvfromv() and sendtov().
+         /// On receive len is the buffer size before and the datagram size after.
+         /// </summary>
+         struct Datagram
+         {
+            char*        buf;
+            int          len;
+            sockaddr_in6 addr;
+            socklen_t    addrlen;
+         };
+
+         /// <summary>
+         /// ::recvmmsg() on Linux and Android.
+         /// Loop of ::recvfrom() on others.
+         /// Receives up to n datagrams, returns how many or SOCKET_ERROR
+         /// if none could be read. Use on non-blocking sockets only.
+         /// </summary>
+         static INLINE int recvfromv(SOCKET s, Datagram* d, int n, int flags = 0)
+         {
+         #if defined(CPPCORE_OS_LINUX) || defined(CPPCORE_OS_ANDROID)
+            mmsghdr msgs[CPPCORE_SOCKET_DGRAMBATCH];
+            iovec   vecs[CPPCORE_SOCKET_DGRAMBATCH];
+            if (n > CPPCORE_SOCKET_DGRAMBATCH)
+               n = CPPCORE_SOCKET_DGRAMBATCH;
+            for (int i = 0; i < n; i++)
+            {
+               vecs[i].iov_base = d[i].buf;
+               vecs[i].iov_len = (size_t)d[i].len;
+               msgs[i].msg_hdr = { };
+               msgs[i].msg_hdr.msg_name = &d[i].addr;
+               msgs[i].msg_hdr.msg_namelen = sizeof(d[i].addr);
+               msgs[i].msg_hdr.msg_iov = &vecs[i];
+               msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            const int r = ::recvmmsg(s, msgs, (unsigned int)n, flags, NULL);
+            for (int i = 0; i < r; i++)
+            {
+               d[i].len = (int)msgs[i].msg_len;
+               d[i].addrlen = msgs[i].msg_hdr.msg_namelen;
+            }
+            return r;
+         #else
+            int i = 0;
+            for (; i < n; i++)
+            {
+               d[i].addrlen = sizeof(d[i].addr);
+               const int rc = Op::recvfrom(s, d[i].buf, d[i].len, flags, (sockaddr*)&d[i].addr, &d[i].addrlen);
+               if (rc < 0)
+                  return i ? i : SOCKET_ERROR;
+               d[i].len = rc;
+            }
+            return i;
+         #endif
+         }
+
+         /// <summary>
+         /// ::sendmmsg() on Linux and Android.
+         /// Loop of ::sendto() on others.
+         /// Sends up to n datagrams, returns how many or SOCKET_ERROR
+         /// if the first one could not be sent.
+         /// </summary>
+         static INLINE int sendtov(SOCKET s, Datagram* d, int n, int flags = 0)
+         {
+         #if defined(CPPCORE_OS_LINUX) || defined(CPPCORE_OS_ANDROID)
+            mmsghdr msgs[CPPCORE_SOCKET_DGRAMBATCH];
+            iovec   vecs[CPPCORE_SOCKET_DGRAMBATCH];
+            if (n > CPPCORE_SOCKET_DGRAMBATCH)
+               n = CPPCORE_SOCKET_DGRAMBATCH;
+            for (int i = 0; i < n; i++)
+            {
+               vecs[i].iov_base = d[i].buf;
+               vecs[i].iov_len = (size_t)d[i].len;
+               msgs[i].msg_hdr = { };
+               msgs[i].msg_hdr.msg_name = &d[i].addr;
+               msgs[i].msg_hdr.msg_namelen = d[i].addrlen;
+               msgs[i].msg_hdr.msg_iov = &vecs[i];
+               msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+            return ::sendmmsg(s, msgs, (unsigned int)n, flags);
+         #else
+            int i = 0;
+            for (; i < n; i++)
+            {
+               const int rc = Op::sendto(s, d[i].buf, d[i].len, flags, (const sockaddr*)&d[i].addr, d[i].addrlen);
+               if (rc < 0)
+                  return i ? i : SOCKET_ERROR;
+            }
+            return i;
+         #endif
+         }
+
+      #if defined(CPPCORE_OS_WINDOWS)
+         using IoVec = WSABUF;
+      #else
+         using IoVec = iovec;
+      #endif
+
+         /// <summary>
+         /// Sets buffer and length of an IoVec.
+         /// </summary>
+         static INLINE void setIoVec(IoVec& v, char* buf, size_t len)
+         {
+         #if defined(CPPCORE_OS_WINDOWS)
+            v.buf = buf;
+            v.len = (ULONG)len;
+         #else
+            v.iov_base = buf;
+            v.iov_len = len;
+         #endif
+         }
+
+         /// <summary>
+         /// ::WSASend() on Windows.
+         /// ::sendmsg() on others.
+         /// Sends n buffers with one call. Returns bytes sent like send().
+         /// </summary>
+         static INLINE int sendv(SOCKET s, IoVec* vecs, int n, int flags = 0)
+         {
+         #if defined(CPPCORE_OS_WINDOWS)
+            DWORD sent;
+            return (0 == ::WSASend(s, vecs, (DWORD)n, &sent, (DWORD)flags, NULL, NULL)) ?
+               (int)sent : SOCKET_ERROR;
+         #else
+            msghdr msg = { };
+            msg.msg_iov = vecs;
+            msg.msg_iovlen = n;
+            return (int)::sendmsg(s, &msg, flags);
+         #endif
+         }
+
          /// <summary>
          /// ::recv()
          /// </summary>
@@ -200,6 +335,32 @@ namespace CppCore
          #endif
          }
 
+      #if defined(CPPCORE_OS_LINUX) || defined(CPPCORE_OS_ANDROID)
+         /// <summary>
+         /// ::epoll_create1()
+         /// </summary>
+         static INLINE int epollCreate(int flags = EPOLL_CLOEXEC)
+         {
+            return ::epoll_create1(flags);
+         }
+
+         /// <summary>
+         /// ::epoll_ctl()
+         /// </summary>
+         static INLINE int epollCtl(int epfd, int op, SOCKET s, epoll_event* ev)
+         {
+            return ::epoll_ctl(epfd, op, s, ev);
+         }
+
+         /// <summary>
+         /// ::epoll_wait()
+         /// </summary>
+         static INLINE int epollWait(int epfd, epoll_event* events, int maxevents, int timeout)
+         {
+            return ::epoll_wait(epfd, events, maxevents, timeout);
+         }
+      #endif
+
          /// <summary>
          /// ::WSAGetLastError() on Windows.
          /// 'errno' global on others.
@@ -453,6 +614,22 @@ namespace CppCore
          return Op::recvfrom(mSocket, buf, len, flags, from, fromlen);
       }
 
+      /// <summary>
+      /// Calls Op::recvfromv() for current socket.
+      /// </summary>
+      INLINE int recvfromv(Op::Datagram* d, int n, int flags = 0)
+      {
+         return Op::recvfromv(mSocket, d, n, flags);
+      }
+
+      /// <summary>
+      /// Calls Op::sendtov() for current socket.
+      /// </summary>
+      INLINE int sendtov(Op::Datagram* d, int n, int flags = 0)
+      {
+         return Op::sendtov(mSocket, d, n, flags);
+      }
+
       ////////////////////////////////////////////////////////////////////////////////////////////////////////////
       // TCP SEND/RECV
       ////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,6 +642,14 @@ namespace CppCore
          return Op::send(mSocket, buf, len, flags);
       }
 
+      /// <summary>
+      /// Calls Op::sendv() for current socket.
+      /// </summary>
+      INLINE int sendv(Op::IoVec* vecs, int n, int flags = 0) 
+      { 
+         return Op::sendv(mSocket, vecs, n, flags);
+      }
+
       /// <summary>
       /// Calls Op::recv() for current socket.
       /// </summary>
@@ -515,6 +700,26 @@ namespace CppCore
          return (SOCKET_ERROR != setsockopt(SOL_SOCKET, SO_REUSEADDR, (char*)&VALUE, sizeof(VALUE)));
       }
 
+      INLINE bool getOptionReusePort() const
+      {
+      #if defined(SO_REUSEPORT)
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(SOL_SOCKET, SO_REUSEPORT, (char*)&VALUE, &LEN) && VALUE);
+      #else
+         return false;
+      #endif
+      }
+
+      INLINE bool setOptionReusePort(bool enabled)
+      {
+      #if defined(SO_REUSEPORT)
+         const int VALUE = (int)enabled;
+         return (SOCKET_ERROR != setsockopt(SOL_SOCKET, SO_REUSEPORT, (char*)&VALUE, sizeof(VALUE)));
+      #else
+         return !enabled;
+      #endif
+      }
+
       INLINE bool getOptionTcpNoDelay() const
       {
          int VALUE; socklen_t LEN = sizeof(VALUE);
@@ -527,6 +732,51 @@ namespace CppCore
          return (SOCKET_ERROR != setsockopt(IPPROTO_TCP, TCP_NODELAY, (char*)&VALUE, sizeof(VALUE)));
       }
 
+      INLINE bool getOptionTcpCork() const
+      {
+      #if defined(TCP_CORK)
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(IPPROTO_TCP, TCP_CORK, (char*)&VALUE, &LEN) && VALUE);
+      #elif defined(TCP_NOPUSH)
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(IPPROTO_TCP, TCP_NOPUSH, (char*)&VALUE, &LEN) && VALUE);
+      #else
+         return false;
+      #endif
+      }
+
+      INLINE bool setOptionTcpCork(bool enabled)
+      {
+      #if defined(TCP_CORK)
+         const int VALUE = (int)enabled;
+         return (SOCKET_ERROR != setsockopt(IPPROTO_TCP, TCP_CORK, (char*)&VALUE, sizeof(VALUE)));
+      #elif defined(TCP_NOPUSH)
+         const int VALUE = (int)enabled;
+         return (SOCKET_ERROR != setsockopt(IPPROTO_TCP, TCP_NOPUSH, (char*)&VALUE, sizeof(VALUE)));
+      #else
+         return !enabled;
+      #endif
+      }
+
+      INLINE int getOptionTcpMaxSegment() const
+      {
+      #if defined(TCP_MAXSEG)
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(IPPROTO_TCP, TCP_MAXSEG, (char*)&VALUE, &LEN)) ? VALUE : -1;
+      #else
+         return -1;
+      #endif
+      }
+
+      INLINE bool setOptionTcpMaxSegment(int size)
+      {
+      #if defined(TCP_MAXSEG) && !defined(CPPCORE_OS_WINDOWS)
+         return (SOCKET_ERROR != setsockopt(IPPROTO_TCP, TCP_MAXSEG, (char*)&size, sizeof(size)));
+      #else
+         return false;
+      #endif
+      }
+
       INLINE bool getOptionLinger() const
       {
          linger VALUE; socklen_t LEN = sizeof(VALUE);
@@ -552,6 +802,28 @@ namespace CppCore
          const int VALUE = (int)enabled;
          return (SOCKET_ERROR != setsockopt(SOL_SOCKET, SO_KEEPALIVE, (char*)&VALUE, sizeof(VALUE)));
       }
+
+      INLINE int getOptionSendBuffer() const
+      {
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(SOL_SOCKET, SO_SNDBUF, (char*)&VALUE, &LEN)) ? VALUE : -1;
+      }
+
+      INLINE bool setOptionSendBuffer(int size)
+      {
+         return (SOCKET_ERROR != setsockopt(SOL_SOCKET, SO_SNDBUF, (char*)&size, sizeof(size)));
+      }
+
+      INLINE int getOptionRecvBuffer() const
+      {
+         int VALUE; socklen_t LEN = sizeof(VALUE);
+         return (SOCKET_ERROR != getsockopt(SOL_SOCKET, SO_RCVBUF, (char*)&VALUE, &LEN)) ? VALUE : -1;
+      }
+
+      INLINE bool setOptionRecvBuffer(int size)
+      {
+         return (SOCKET_ERROR != setsockopt(SOL_SOCKET, SO_RCVBUF, (char*)&size, sizeof(size)));
+      }
    };
 }
 
@@ -18,6 +18,14 @@
 #define CPPCORE_TCPLINK_DEFAULT_QUEUESIZE_TCP_OUT 64
 #endif
 
+#ifndef CPPCORE_TCPLINK_SENDBATCH
+#define CPPCORE_TCPLINK_SENDBATCH 64 // max. message buffers gathered into one sendv() call
+#endif
+
+#if defined(IOV_MAX) && (CPPCORE_TCPLINK_SENDBATCH > IOV_MAX)
+#error CPPCORE_TCPLINK_SENDBATCH exceeds IOV_MAX
+#endif
+
 namespace CppCore
 {
    /// <summary>
@@ -29,6 +37,8 @@ namespace CppCore
 
    /// <summary>
    /// Default Pool Type if not specified.
+   /// Has no magazines, buffers are popped by the receiving thread
+   /// and pushed back by the sending one (or the other way round).
    /// </summary>
    template<
       typename TMSGTCP = TcpLinkMessage<>,
@@ -100,7 +110,8 @@ namespace CppCore
       TQUEUEREAD  mMessagesRecv;
       TQUEUEWRITE mMessagesSend;
       TMSGTCP*    mCurrentMessageIn;
-      TMSGTCP*    mCurrentMessageOut;
+      TMSGTCP*    mMessagesOut[CPPCORE_TCPLINK_SENDBATCH];
+      size_t      mNumMessagesOut;
       uint64_t    mBytesReceived;
       uint64_t    mBytesSent;
       TimePoint   mStartTime;
@@ -108,6 +119,7 @@ namespace CppCore
       TimePointHR mLastSend;
       bool        mIsClosing;
       bool        mSendBlocked;
+      bool        mCork;
 
       /// <summary>
       /// Allow subclasses to check outgoing msg before it is actually sent.
@@ -139,6 +151,81 @@ namespace CppCore
       /// </summary>
       INLINE virtual size_t getMissingLength(TMSGTCP& msg) const { return msg.getRemaining(); }
 
+      /// <summary>
+      /// Pushes all gathered but not fully sent messages back to the pool.
+      /// </summary>
+      INLINE void freeMessagesOut()
+      {
+         for (size_t i = 0; i < mNumMessagesOut; i++)
+            mPoolMessageTcp.pushBack(mMessagesOut[i]);
+         mNumMessagesOut = 0;
+      }
+
+      /// <summary>
+      /// Moves enqueued messages into the gather list until it is full.
+      /// Returns true if it's full.
+      /// </summary>
+      INLINE bool gatherMessagesOut(Callback& cb)
+      {
+         TMSGTCP* msg;
+         while (mNumMessagesOut < CPPCORE_TCPLINK_SENDBATCH)
+         {
+            // try to get a new message to send
+            if (!mMessagesSend.popFront(msg))
+               return false;
+
+            // reset the read length 
+            msg->setLengthRead(0);
+
+            // let subclasses do a final check whether to send or not
+            if (!onSendCheckTcp(*msg))
+            {
+               cb.onSendCheckTcpFailed(*msg);
+               mPoolMessageTcp.pushBack(msg);
+               continue;
+            }
+
+            // let callback finish (e.g. header/crc) 
+            // this msg before it finally goes out
+            cb.onSendFinalizeTcp(*msg);
+
+            // nothing to send for this message
+            if (msg->getRemainingRead() == 0)
+            {
+               mPoolMessageTcp.pushBack(msg);
+               continue;
+            }
+
+            mMessagesOut[mNumMessagesOut++] = msg;
+         }
+         return true;
+      }
+
+      /// <summary>
+      /// Advances the gather list by bytes sent. Fully sent messages
+      /// are pushed back to the pool, a partially sent one becomes first.
+      /// </summary>
+      INLINE void advanceMessagesOut(size_t bytes)
+      {
+         size_t done = 0;
+         while (done < mNumMessagesOut)
+         {
+            TMSGTCP* msg = mMessagesOut[done];
+            const size_t LENLEFT = msg->getRemainingRead();
+            if (bytes < LENLEFT)
+            {
+               msg->setLengthRead(msg->getLengthRead() + bytes);
+               break;
+            }
+            bytes -= LENLEFT;
+            mPoolMessageTcp.pushBack(msg);
+            done++;
+         }
+         mNumMessagesOut -= done;
+         for (size_t i = 0; i < mNumMessagesOut; i++)
+            mMessagesOut[i] = mMessagesOut[i + done];
+      }
+
    public:
       /// <summary>
       /// Constructor
@@ -149,14 +236,15 @@ namespace CppCore
          mMessagesRecv(),
          mMessagesSend(),
          mCurrentMessageIn(NULL),
-         mCurrentMessageOut(NULL),
+         mNumMessagesOut(0),
          mBytesReceived(0),
          mBytesSent(0),
          mStartTime(Duration::zero()),
          mLastReceive(DurationHR::zero()),
          mLastSend(DurationHR::zero()),
          mIsClosing(false),
-         mSendBlocked(false) { }
+         mSendBlocked(false),
+         mCork(false) { }
 
       /// <summary>
       /// Destructor
@@ -166,8 +254,7 @@ namespace CppCore
          if (mCurrentMessageIn)
             mPoolMessageTcp.pushBack(mCurrentMessageIn);
 
-         if (mCurrentMessageOut)
-            mPoolMessageTcp.pushBack(mCurrentMessageOut);
+         freeMessagesOut();
       }
 
       /// <summary>
@@ -230,6 +317,19 @@ namespace CppCore
       /// </summary>
       INLINE bool isSendBlocked() const { return mSendBlocked; }
 
+      /// <summary>
+      /// True if bursts of more than CPPCORE_TCPLINK_SENDBATCH messages
+      /// are bracketed with TCP_CORK (or TCP_NOPUSH) in send().
+      /// </summary>
+      INLINE bool isCork() const { return mCork; }
+
+      /// <summary>
+      /// Enables or disables TCP_CORK bracketing of large bursts in send().
+      /// It costs two extra syscalls per corked send() but avoids 
+      /// a partial segment after each sendv() call of the burst.
+      /// </summary>
+      INLINE void setCork(bool enabled) { mCork = enabled; }
+
       /////////////////////////////////////////////////////////////////////////////////////////////////
       // TCPSOCKET
       /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,11 +434,7 @@ namespace CppCore
             mCurrentMessageIn = NULL;
          }
          
-         if (mCurrentMessageOut)
-         {
-            mPoolMessageTcp.pushBack(mCurrentMessageOut);
-            mCurrentMessageOut = NULL;
-         }
+         freeMessagesOut();
 
          mBytesReceived = 0;
          mBytesSent = 0;
@@ -403,71 +499,43 @@ namespace CppCore
    public:
       /// <summary>
       /// Writes all enqueued message buffers to the tcp socket.
+      /// Gathers up to CPPCORE_TCPLINK_SENDBATCH of them into one sendv() call.
       /// </summary>
       INLINE virtual void send(Callback& cb)
       {
+         bool corked = false;
+
          // sender loop
          while (true)
          {
-            // if we're sendindg a new message and don't continue
-            if (!mCurrentMessageOut)
-            {
-               // try to get a new message to send
-               if (mMessagesSend.popFront(mCurrentMessageOut))
-               {
-                  // reset the read length 
-                  mCurrentMessageOut->setLengthRead(0);
+            // fill up the gather list, cork if more is still queued behind it
+            if (gatherMessagesOut(cb) && mCork && !corked && mMessagesSend.length() != 0)
+               corked = mSocket.setOptionTcpCork(true);
 
-                  // let subclasses do a final check whether to send or not
-                  if (!onSendCheckTcp(*mCurrentMessageOut))
-                  {
-                     cb.onSendCheckTcpFailed(*mCurrentMessageOut);
-                     mPoolMessageTcp.pushBack(mCurrentMessageOut);
-                     mCurrentMessageOut = NULL;
-                     continue;
-                  }
-
-                  // let callback finish (e.g. header/crc) 
-                  // this msg before it finally goes out
-                  cb.onSendFinalizeTcp(*mCurrentMessageOut);
-               }
-
-               // done: nothing to send
-               else
-                  return;
-            }
+            // done: nothing to send
+            if (mNumMessagesOut == 0)
+               break;
 
             //________________________________________________________________//
-            // see if done
-
-            const size_t LENLEFT = mCurrentMessageOut->getRemainingRead();
-            const size_t LENREAD = mCurrentMessageOut->getLengthRead();
+            // send
 
-            // nothing more to send for this message
-            if (LENLEFT == 0)
+            Socket::Op::IoVec vecs[CPPCORE_TCPLINK_SENDBATCH];
+            for (size_t i = 0; i < mNumMessagesOut; i++)
             {
-               // add current to free buffers again
-               mPoolMessageTcp.pushBack(mCurrentMessageOut);
-               mCurrentMessageOut = NULL;
-
-               // process possible next pending message
-               continue;
+               TMSGTCP* msg = mMessagesOut[i];
+               Socket::Op::setIoVec(vecs[i], msg->getPtrRead(), msg->getRemainingRead());
             }
 
-            //________________________________________________________________//
-            // send
-
             // try to send what's left to send
-            const int rc = mSocket.send(
-               mCurrentMessageOut->getPtrRead(), (int)LENLEFT);
+            const int rc = mSocket.sendv(vecs, (int)mNumMessagesOut);
 
-            // some data was sent, update read (sent) length and loop again
+            // some data was sent, update read (sent) lengths and loop again
             if (rc > 0)
             {
                mSendBlocked = false;
                mBytesSent += rc;
                mLastSend = ClockHR::now();
-               mCurrentMessageOut->setLengthRead(LENREAD + rc);
+               advanceMessagesOut((size_t)rc);
                cb.onSendDataTransmitted((uint32_t)rc);
             }
 
@@ -495,14 +563,17 @@ namespace CppCore
                else
                {
                   cb.onSendError();
-                  mPoolMessageTcp.pushBack(mCurrentMessageOut);
-                  mCurrentMessageOut = NULL;
+                  freeMessagesOut();
                }
 
                // nothing more to do, either dead or notified
                break;
             }
          }
+
+         // flush the corked burst
+         if (corked)
+            mSocket.setOptionTcpCork(false);
       }
 
       /// <summary>
@@ -100,6 +100,44 @@
   NS_CTR(496), NS_CTR(497), NS_CTR(498), NS_CTR(499), NS_CTR(500), NS_CTR(501), NS_CTR(502), NS_CTR(503),\
   NS_CTR(504), NS_CTR(505), NS_CTR(506), NS_CTR(507), NS_CTR(508), NS_CTR(509), NS_CTR(510), NS_CTR(511)
 
+// In-Place Constructor for 8 Sessions starting at offset o
+#define CPPCORE_SFIXCTR8_OFS(o) \
+  NS_CTR((o)+0), NS_CTR((o)+1), NS_CTR((o)+2), NS_CTR((o)+3), NS_CTR((o)+4), NS_CTR((o)+5), NS_CTR((o)+6), NS_CTR((o)+7)
+
+// In-Place Constructor for 64 Sessions starting at offset o
+#define CPPCORE_SFIXCTR64_OFS(o) \
+  CPPCORE_SFIXCTR8_OFS((o)+0), \
+  CPPCORE_SFIXCTR8_OFS((o)+8), \
+  CPPCORE_SFIXCTR8_OFS((o)+16), \
+  CPPCORE_SFIXCTR8_OFS((o)+24), \
+  CPPCORE_SFIXCTR8_OFS((o)+32), \
+  CPPCORE_SFIXCTR8_OFS((o)+40), \
+  CPPCORE_SFIXCTR8_OFS((o)+48), \
+  CPPCORE_SFIXCTR8_OFS((o)+56)
+
+// In-Place Constructor for 512 Sessions starting at offset o
+#define CPPCORE_SFIXCTR512_OFS(o) \
+  CPPCORE_SFIXCTR64_OFS((o)+0), \
+  CPPCORE_SFIXCTR64_OFS((o)+64), \
+  CPPCORE_SFIXCTR64_OFS((o)+128), \
+  CPPCORE_SFIXCTR64_OFS((o)+192), \
+  CPPCORE_SFIXCTR64_OFS((o)+256), \
+  CPPCORE_SFIXCTR64_OFS((o)+320), \
+  CPPCORE_SFIXCTR64_OFS((o)+384), \
+  CPPCORE_SFIXCTR64_OFS((o)+448)
+
+// In-Place Constructor for 1024 Sessions
+#define CPPCORE_SFIXCTR1024 CPPCORE_SFIXCTR512, CPPCORE_SFIXCTR512_OFS(512)
+
+// In-Place Constructor for 2048 Sessions
+#define CPPCORE_SFIXCTR2048 CPPCORE_SFIXCTR1024, \
+  CPPCORE_SFIXCTR512_OFS(1024), CPPCORE_SFIXCTR512_OFS(1536)
+
+// In-Place Constructor for 4096 Sessions
+#define CPPCORE_SFIXCTR4096 CPPCORE_SFIXCTR2048, \
+  CPPCORE_SFIXCTR512_OFS(2048), CPPCORE_SFIXCTR512_OFS(2560), \
+  CPPCORE_SFIXCTR512_OFS(3072), CPPCORE_SFIXCTR512_OFS(3584)
+
 // Select In-Place Constructor
 #if   CPPCORE_NETSERVER_MAXCLIENTS == 32
 #define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR32
@@ -111,6 +149,12 @@
 #define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR256
 #elif CPPCORE_NETSERVER_MAXCLIENTS == 512
 #define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR512
+#elif CPPCORE_NETSERVER_MAXCLIENTS == 1024
+#define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR1024
+#elif CPPCORE_NETSERVER_MAXCLIENTS == 2048
+#define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR2048
+#elif CPPCORE_NETSERVER_MAXCLIENTS == 4096
+#define CPPCORE_NETSERVER_SESSION_CTR CPPCORE_SFIXCTR4096
 #else
 #error "Unsupported CPPCORE_NETSERVER_MAXCLIENTS"
 #endif
@@ -126,8 +170,8 @@ namespace CppCore
       typename TMSGTCP      = TcpLinkMessage<>, 
       typename TSHAREDDATA  = TcpSessionSharedData<TMSGTCP>,
       typename TSESSION     = TcpSession<TMSGTCP, TSHAREDDATA>,
-      typename TPOOLSESSION = TcpSessionPool<TSESSION, CPPCORE_NETSERVER_MAXCLIENTS>,
-      typename TPOLLSESSION = Array::Fix::ST<TSESSION*, CPPCORE_NETSERVER_MAXCLIENTS>>
+      typename TPOOLSESSION = TcpSessionPool<TSESSION, CPPCORE_NETSERVER_SESSIONSPERREACTOR>,
+      typename TPOLLSESSION = Array::Fix::ST<TSESSION*, CPPCORE_NETSERVER_SESSIONSPERREACTOR>>
    class CPPCORE_ALIGN16 TcpServer : 
       public Logger::Producer<Logger, Logger::Channel::Network>, 
       public TSESSION::Callback
@@ -158,72 +202,206 @@ namespace CppCore
          INLINE virtual void onSessionDisconnected(TSESSION& session) { }
       };
 
+      /// <summary>
+      /// Number of sessions owned by each reactor.
+      /// </summary>
+      static constexpr size_t SESSIONSPERREACTOR = CPPCORE_NETSERVER_SESSIONSPERREACTOR;
+
+      static_assert(CPPCORE_NETSERVER_REACTORS > 0,
+         "CPPCORE_NETSERVER_REACTORS must be at least 1");
+
+      static_assert(SESSIONSPERREACTOR * CPPCORE_NETSERVER_REACTORS == CPPCORE_NETSERVER_MAXCLIENTS,
+         "CPPCORE_NETSERVER_MAXCLIENTS must be a multiple of CPPCORE_NETSERVER_REACTORS");
+
+   protected:
+      /// <summary>
+      /// Owns a listening socket, the accept and poll runnables and
+      /// a fixed share of the sessions. With more than one reactor all
+      /// listening sockets are bound using SO_REUSEPORT and the kernel
+      /// distributes incoming connections between them.
+      /// </summary>
+      class CPPCORE_ALIGN64 Reactor
+      {
+      public:
+         CPPCORE_ALIGN16 TcpSocket    mSocketTcp;
+         CPPCORE_ALIGN16 Runnable     mRunnablePollAccept;
+         CPPCORE_ALIGN16 Runnable     mRunnablePollTcp;
+      #if CPPCORE_NETSERVER_EPOLL
+         CPPCORE_ALIGN16 int          mEpoll;
+         CPPCORE_ALIGN16 TimePointHR  mLastTimeoutCheck;
+         CPPCORE_ALIGN16 epoll_event  mEpollEvents[CPPCORE_NETSERVER_EPOLL_MAXEVENTS];
+         CPPCORE_ALIGN16 atomic<uint32_t> mGenerations[SESSIONSPERREACTOR];
+      #else
+         CPPCORE_ALIGN16 pollfd       mPollTcp[SESSIONSPERREACTOR];
+         CPPCORE_ALIGN16 TPOLLSESSION mPollSessions;
+      #endif
+         CPPCORE_ALIGN16 TPOOLSESSION mSessionsFree;
+         CPPCORE_ALIGN16 TSESSION*    mSessions;
+
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE Reactor() :
+         #if CPPCORE_NETSERVER_EPOLL
+            mEpoll(-1),
+            mGenerations{},
+         #endif
+            mSessions(0) { }
+      };
+
    protected:
       CPPCORE_ALIGN16 Handler&     mHandler;
       CPPCORE_ALIGN16 Handler&     mThreadPool;
       CPPCORE_ALIGN16 Handler&     mMessageHandler;
       CPPCORE_ALIGN16 Callback&    mCallback;
       CPPCORE_ALIGN16 uint16_t     mPort;
-      CPPCORE_ALIGN16 TcpSocket    mSocketTcp;
       CPPCORE_ALIGN16 DurationHR   mTimeoutReceive;
-      CPPCORE_ALIGN16 Runnable     mRunnablePollAccept;
-      CPPCORE_ALIGN16 Runnable     mRunnablePollTcp;
-      CPPCORE_ALIGN16 pollfd       mPollTcp[CPPCORE_NETSERVER_MAXCLIENTS];
       CPPCORE_ALIGN16 TSHAREDDATA  mSharedData;
-      CPPCORE_ALIGN16 TPOLLSESSION mPollSessions;
-      CPPCORE_ALIGN16 TPOOLSESSION mSessionsFree;
+      CPPCORE_ALIGN16 Reactor      mReactors[CPPCORE_NETSERVER_REACTORS];
       CPPCORE_ALIGN16 TSESSION     mSessions[CPPCORE_NETSERVER_MAXCLIENTS]{ CPPCORE_NETSERVER_SESSION_CTR };
 
+      /// <summary>
+      /// Returns the reactor owning a session.
+      /// </summary>
+      INLINE Reactor& getReactor(const TSESSION& session)
+      {
+         return mReactors[session.getId() / SESSIONSPERREACTOR];
+      }
+
       ///////////////////////////////////////////////////////////////////////////////////////////////////////////
       // RUNNABLES
       ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 
       /// <summary>
-      /// Accepts incoming TCP connections
+      /// Accepts incoming TCP connections on the listening socket of a reactor
       /// </summary>
-      INLINE void runPollAccept(const int timeout = 16)
+      INLINE void runPollAccept(Reactor& reactor, const int timeout = 16)
       {
          // poll up to timeout
-         if (mSocketTcp.poll(POLLIN, timeout))
+         if (reactor.mSocketTcp.poll(POLLIN, timeout))
          {
             TSESSION* session;
-            if (mSessionsFree.popBack(session))
+            if (reactor.mSessionsFree.popBack(session))
             {
                // try to accept new client
-               if (session->acceptFrom(mSocketTcp))
+               if (session->acceptFrom(reactor.mSocketTcp))
+               {
                   session->logDebug("New session accepted");
-
+               #if CPPCORE_NETSERVER_EPOLL
+                  // register once for all future events, closing the socket unregisters it.
+                  // the session id is tagged with a new generation so events still queued
+                  // for a previous connection on the same slot can be told apart.
+                  const uint32_t ID  = session->getId();
+                  const uint32_t GEN = reactor.mGenerations[ID % SESSIONSPERREACTOR].fetch_add(
+                     1U, ::std::memory_order_relaxed) + 1U;
+                  epoll_event ev;
+                  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+                  ev.data.u64 = ((uint64_t)GEN << 32) | ID;
+                  if (Socket::Op::epollCtl(reactor.mEpoll, EPOLL_CTL_ADD, session->getSocketOS(), &ev) != 0)
+                  {
+                     session->logError("Failed to register client socket on epoll");
+                     session->close();
+                  }
+               #endif
+               }
                else
                {
-                  mSessionsFree.pushBack(session);
+                  reactor.mSessionsFree.pushBack(session);
                   session->logWarn("Failed to accept client socket");
                }
             }
             else
             {
                // reject new client (max reached)
-               mSocketTcp.acceptAndClose();
+               reactor.mSocketTcp.acceptAndClose();
                logWarn("New session rejected. All slots full.");
             }
          }
       }
 
+   #if CPPCORE_NETSERVER_EPOLL
+      /// <summary>
+      /// Disconnects all idle/timed-out sessions of a reactor.
+      /// </summary>
+      INLINE void checkTimeouts(Reactor& reactor, const TimePointHR& now)
+      {
+         for (size_t i = 0; i < SESSIONSPERREACTOR; i++)
+         {
+            TSESSION& session = reactor.mSessions[i];
+
+            // disconnect idle/timed-out sessions
+            if (session.isActive() && now - session.getLastReceiveTcp() > mTimeoutReceive)
+            {
+               session.log("Disconnecting timed-out client.");
+               session.close();
+            }
+         }
+      }
+
+      /// <summary>
+      /// Waits for edge-triggered events on the TCP sockets of clients and
+      /// reads pending data if any. Also observes writability after send blocks.
+      /// Only sessions with events are touched, idle ones are checked for
+      /// timeouts every CPPCORE_NETSERVER_TIMEOUTCHECK milliseconds.
+      /// </summary>
+      INLINE void runPollTcp(Reactor& reactor)
+      {
+         // how long we will wait for events
+         constexpr int POLLMS = 16;
+
+         // wait for events (also sleeps if no client is connected)
+         const int r = Socket::Op::epollWait(
+            reactor.mEpoll, reactor.mEpollEvents, CPPCORE_NETSERVER_EPOLL_MAXEVENTS, POLLMS);
+
+         // process the ones that have events
+         for (int i = 0; i < r; i++)
+         {
+            const uint64_t TAG = reactor.mEpollEvents[i].data.u64;
+            const uint32_t IDX = (uint32_t)TAG % SESSIONSPERREACTOR;
+            const uint32_t GEN = (uint32_t)(TAG >> 32);
+            TSESSION& session  = reactor.mSessions[IDX];
+
+            // skip events of sessions that were closed by an earlier event
+            // of this batch or that were closed and accepted again since
+            if (!session.isActive() ||
+                reactor.mGenerations[IDX].load(::std::memory_order_relaxed) != GEN)
+               continue;
+
+            const uint32_t EV = reactor.mEpollEvents[i].events;
+            const short REVENTS = (short)(
+               ((EV & EPOLLIN)  ? POLLIN  : 0) |
+               ((EV & EPOLLOUT) ? POLLOUT : 0) |
+               ((EV & EPOLLERR) ? POLLERR : 0) |
+               ((EV & (EPOLLHUP | EPOLLRDHUP)) ? POLLHUP : 0));
+
+            session.recvPendingTcp(REVENTS);
+         }
+
+         // check for timed-out sessions at a coarse interval
+         const TimePointHR now = ClockHR::now();
+         if (now - reactor.mLastTimeoutCheck >= milliseconds(CPPCORE_NETSERVER_TIMEOUTCHECK))
+         {
+            reactor.mLastTimeoutCheck = now;
+            checkTimeouts(reactor, now);
+         }
+      }
+   #else
       /// <summary>
-      /// Polls the TCP sockets of clients and reads pending data if any.
+      /// Polls the TCP sockets of the clients of a reactor and reads pending data if any.
       /// Also observes writability after send blocks.
       /// </summary>
-      INLINE void runPollTcp()
+      INLINE void runPollTcp(Reactor& reactor)
       {
          // clear sessions to poll
-         mPollSessions.clear();
+         reactor.mPollSessions.clear();
 
          // current timestamp
          const TimePointHR now = ClockHR::now();
 
          // build poll data of connected clients
-         for (int i = 0; i < CPPCORE_NETSERVER_MAXCLIENTS; i++)
+         for (size_t i = 0; i < SESSIONSPERREACTOR; i++)
          {
-            TSESSION& session = mSessions[i];
+            TSESSION& session = reactor.mSessions[i];
 
             // ignore unused sessions
             if (!session.isActive())
@@ -242,19 +420,19 @@ namespace CppCore
                POLLIN : POLLIN | POLLOUT;
 
             // idx of next poll entry
-            const size_t IDX = mPollSessions.length();
+            const size_t IDX = reactor.mPollSessions.length();
 
             // set poll entry
-            mPollTcp[IDX].fd = session.getSocketOS();
-            mPollTcp[IDX].events = EVENTS;
-            mPollTcp[IDX].revents = 0;
+            reactor.mPollTcp[IDX].fd = session.getSocketOS();
+            reactor.mPollTcp[IDX].events = EVENTS;
+            reactor.mPollTcp[IDX].revents = 0;
 
             // save polled session
-            mPollSessions.pushBack(&mSessions[i]);
+            reactor.mPollSessions.pushBack(&session);
          }
 
          // how many we're going to observe
-         const size_t LEN = mPollSessions.length();
+         const size_t LEN = reactor.mPollSessions.length();
 
          // and how long we will poll them
          constexpr int POLLMS = 16;
@@ -267,7 +445,7 @@ namespace CppCore
          else
          {
             // poll them now
-            const int r = Socket::Op::poll(mPollTcp, (int)LEN, POLLMS);
+            const int r = Socket::Op::poll(reactor.mPollTcp, (int)LEN, POLLMS);
 
             // < 0 error || = 0 timeout || > 0 new tcp data or write recover for this many sockets
             if (r <= 0)
@@ -276,10 +454,11 @@ namespace CppCore
             // process the ones that have data
             // TODO: consider triggering this as runnable on pool?
             for (size_t i = 0; i < LEN; i++)
-               if (mPollTcp[i].revents)
-                  mPollSessions[i]->recvPendingTcp(mPollTcp[i]);
+               if (reactor.mPollTcp[i].revents)
+                  reactor.mPollSessions[i]->recvPendingTcp(reactor.mPollTcp[i]);
          }
       }
+   #endif
 
       ///////////////////////////////////////////////////////////////////////////////////////////////////////////
       // TCPSESSION CALLBACK
@@ -301,7 +480,7 @@ namespace CppCore
       {
          auto& s = dynamic_cast<TSESSION&>(session);
          mCallback.onSessionDisconnected(dynamic_cast<TSESSION&>(session));
-         mSessionsFree.pushBack(&s);
+         getReactor(s).mSessionsFree.pushBack(&s);
       }
 
       /// <summary>
@@ -313,6 +492,43 @@ namespace CppCore
          mCallback.onSessionAccepted(s);
       }
 
+      ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+      // HELPERS
+      ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+      /// <summary>
+      /// Logs a failed listen() on a reactor.
+      /// </summary>
+      INLINE void logListenError(const TcpSocket::ListenReturn lr)
+      {
+         switch (lr)
+         {
+         case TcpSocket::ListenReturn::NotClosed:
+            logError("Existing socket not closed.");
+            break;
+         case TcpSocket::ListenReturn::FailOnInit:
+            logError("Failed to create tcp socket.");
+            break;
+         case TcpSocket::ListenReturn::FailOnOptNoBlock:
+            logError("Failed to enable FIONBIO (noblock) on tcp socket.");
+            break;
+         case TcpSocket::ListenReturn::FailOnOptIP6Only:
+            logError("Failed to disable IPV6_V6ONLY on tcp socket.");
+            break;
+         case TcpSocket::ListenReturn::FailOnOptReusePort:
+            logError("Failed to enable SO_REUSEPORT on tcp socket.");
+            break;
+         case TcpSocket::ListenReturn::FailOnBind:
+            logError("Failed to bind tcp socket.");
+            break;
+         case TcpSocket::ListenReturn::FailOnListen:
+            logError("Failed to listen on tcp socket.");
+            break;
+         default:
+            break;
+         }
+      }
+
    public:
       /// <summary>
       /// Constructor
@@ -327,60 +543,86 @@ namespace CppCore
          const DurationHR& timeoutReceive = seconds(5)) :
          Logger::Producer<Logger, Logger::Channel::Network>(logger),
          mPort(port),
-         mSocketTcp(),
          mTimeoutReceive(timeoutReceive),
-         mRunnablePollAccept([this]() { runPollAccept(); }, milliseconds(0)),
-         mRunnablePollTcp([this]() { runPollTcp(); }, milliseconds(0)),
          mHandler(handler),
          mThreadPool(threadPool),
          mMessageHandler(messageHandler),
          mCallback(callBack)
       {
-         // add all sessions to free ones
-         for (int i = CPPCORE_NETSERVER_MAXCLIENTS - 1; i >= 0; i--)
-            mSessionsFree.pushBack(&mSessions[i]);
-
          // log listen start
-         log("Creating TCP socket and binding to port " + std::to_string(mPort));
-
-         // start listening
-         const TcpSocket::ListenReturn lr = 
-            mSocketTcp.listen(mPort);
+         log("Creating TCP socket and binding to port " + std::to_string(mPort) + 
+            " (" + std::to_string(CPPCORE_NETSERVER_REACTORS) + " reactors)");
 
-         if (lr == TcpSocket::ListenReturn::OK)
+         for (size_t r = 0; r < CPPCORE_NETSERVER_REACTORS; r++)
          {
-            // schedule poll runnables
-            mThreadPool.schedule(mRunnablePollAccept);
-            mThreadPool.schedule(mRunnablePollTcp);
+            Reactor& reactor = mReactors[r];
+
+            // assign the reactor its share of the sessions and add them to free ones
+            reactor.mSessions = &mSessions[r * SESSIONSPERREACTOR];
+            for (size_t i = SESSIONSPERREACTOR; i-- > 0;)
+               if (!reactor.mSessionsFree.pushBack(&reactor.mSessions[i]))
+                  logError("Session pool smaller than sessions per reactor.");
+
+            // set up poll runnables of this reactor
+            reactor.mRunnablePollAccept.setFunction([this, &reactor]() { runPollAccept(reactor); });
+            reactor.mRunnablePollAccept.setInterval(milliseconds(0));
+            reactor.mRunnablePollAccept.setRepeat(true);
+            reactor.mRunnablePollTcp.setFunction([this, &reactor]() { runPollTcp(reactor); });
+            reactor.mRunnablePollTcp.setInterval(milliseconds(0));
+            reactor.mRunnablePollTcp.setRepeat(true);
          }
 
-         // failed to listen on tcp socket
-         else
+         // listen on all reactors or on none, the kernel would
+         // still hand connections to a reactor that can't serve them
+         bool ok = true;
+         for (size_t r = 0; ok && r < CPPCORE_NETSERVER_REACTORS; r++)
          {
-            switch (lr)
+            Reactor& reactor = mReactors[r];
+
+         #if CPPCORE_NETSERVER_EPOLL
+            // create epoll instance for the client sockets
+            reactor.mEpoll = Socket::Op::epollCreate();
+            reactor.mLastTimeoutCheck = ClockHR::now();
+            if (reactor.mEpoll < 0)
             {
-            case TcpSocket::ListenReturn::NotClosed:
-               logError("Existing socket not closed.");
-               break;
-            case TcpSocket::ListenReturn::FailOnInit:
-               logError("Failed to create tcp socket.");
-               break;
-            case TcpSocket::ListenReturn::FailOnOptNoBlock:
-               logError("Failed to enable FIONBIO (noblock) on tcp socket.");
-               break;
-            case TcpSocket::ListenReturn::FailOnOptIP6Only:
-               logError("Failed to disable IPV6_V6ONLY on tcp socket.");
-               break;
-            case TcpSocket::ListenReturn::FailOnBind:
-               logError("Failed to bind tcp socket.");
-               break;
-            case TcpSocket::ListenReturn::FailOnListen:
-               logError("Failed to listen on tcp socket.");
-               break;
-            default:
+               logError("Failed to create epoll instance.");
+               ok = false;
                break;
             }
-            //TODO: Add some kind of auto-repeat?
+         #endif
+
+            // start listening, share the port if there are several reactors
+            const TcpSocket::ListenReturn lr = reactor.mSocketTcp.listen(mPort,
+               TcpSocket::ListenDefaults::NODELAY,
+               TcpSocket::ListenDefaults::REUSEADDR,
+               TcpSocket::ListenDefaults::LINGER,
+               TcpSocket::ListenDefaults::LTIME,
+               TcpSocket::ListenDefaults::KEEPALIVE,
+               CPPCORE_NETSERVER_REACTORS > 1);
+
+            // failed to listen on tcp socket
+            if (lr != TcpSocket::ListenReturn::OK)
+            {
+               logListenError(lr);
+               ok = false;
+               //TODO: Add some kind of auto-repeat?
+            }
+         }
+
+         for (size_t r = 0; r < CPPCORE_NETSERVER_REACTORS; r++)
+         {
+            Reactor& reactor = mReactors[r];
+
+            // schedule poll runnables
+            if (ok)
+            {
+               mThreadPool.schedule(reactor.mRunnablePollAccept);
+               mThreadPool.schedule(reactor.mRunnablePollTcp);
+            }
+
+            // or stop listening on the ones that succeeded
+            else if (reactor.mSocketTcp.isUsed())
+               reactor.mSocketTcp.close();
          }
       }
 
@@ -389,13 +631,24 @@ namespace CppCore
       /// </summary>
       INLINE ~TcpServer()
       {
-         // disable timers
-         mRunnablePollAccept.setRepeat(false);
-         mRunnablePollTcp.setRepeat(false);
+         for (size_t r = 0; r < CPPCORE_NETSERVER_REACTORS; r++)
+         {
+            Reactor& reactor = mReactors[r];
+
+            // disable timers
+            reactor.mRunnablePollAccept.setRepeat(false);
+            reactor.mRunnablePollTcp.setRepeat(false);
 
-         // remove from schedule
-         mThreadPool.cancel(mRunnablePollAccept);
-         mThreadPool.cancel(mRunnablePollTcp);
+            // remove from schedule
+            mThreadPool.cancel(reactor.mRunnablePollAccept);
+            mThreadPool.cancel(reactor.mRunnablePollTcp);
+
+         #if CPPCORE_NETSERVER_EPOLL
+            // close epoll instance
+            if (reactor.mEpoll >= 0)
+               Socket::Op::close(reactor.mEpoll);
+         #endif
+         }
 
          // delete sessions ?
       }
@@ -405,12 +658,24 @@ namespace CppCore
       /// </summary>
       INLINE TSHAREDDATA& getSharedData() { return mSharedData; }
 
+      /// <summary>
+      /// True if all reactors are listening. False if creating the epoll
+      /// instance or listening failed on any of them in the constructor.
+      /// </summary>
+      INLINE bool isListening() const { return mReactors[0].mSocketTcp.isUsed(); }
+
+      /// <summary>
+      /// Gets the listening TCP socket of the first reactor.
+      /// All reactors are bound to the same address.
+      /// </summary>
+      INLINE TcpSocket& getSocketTcp() { return mReactors[0].mSocketTcp; }
+
       /// <summary>
       /// 
       /// </summary>
       INLINE bool pushFreeSession(TSESSION& s)
       {
-         return mSessionsFree.pushBack(&s);
+         return getReactor(s).mSessionsFree.pushBack(&s);
       }
    };
 }
@@ -10,8 +10,9 @@ namespace CppCore
 {
    /// <summary>
    /// Default Pool Type if not specified.
+   /// Holds the free sessions of one reactor of a server.
    /// </summary>
-   template<typename TSESSION, size_t SIZE = CPPCORE_NETSERVER_MAXCLIENTS>
+   template<typename TSESSION, size_t SIZE = CPPCORE_NETSERVER_SESSIONSPERREACTOR>
    using TcpSessionPool = Array::Fix::MT<TSESSION*, SIZE>;
 
    /// <summary>
@@ -522,6 +523,15 @@ namespace CppCore
       /// Processes this session based on pollfd info
       /// </summary>
       INLINE void recvPendingTcp(pollfd& pollfd)
+      {
+         recvPendingTcp(pollfd.revents);
+      }
+
+      /// <summary>
+      /// Processes this session based on returned poll events (POLLIN, POLLOUT, ...).
+      /// Data is read until the socket would block, so this is also safe for edge-triggered events.
+      /// </summary>
+      INLINE void recvPendingTcp(const short revents)
       {
          // lock
          CPPCORE_MUTEX_LOCK(mMutexClearRead);
@@ -530,13 +540,13 @@ namespace CppCore
          if (isActive())
          {
             // receive available tcp data from winsock
-            if ((pollfd.revents & POLLIN) || (pollfd.revents & POLLHUP) || (pollfd.revents & POLLERR))
+            if ((revents & POLLIN) || (revents & POLLHUP) || (revents & POLLERR))
             {
                mTcpLink.receive(*this);
             }
 
             // schedule sending of outgoing tcpdata after block
-            if (pollfd.revents & POLLOUT)
+            if (revents & POLLOUT)
             {
                if (mTcpLink.isSendBlocked())
                {
@@ -85,13 +85,14 @@ namespace CppCore
       /// Return Values of listen()
       /// </summary>
       enum class ListenReturn {
-         OK               = 0,
-         NotClosed        = 1,
-         FailOnInit       = 2,
-         FailOnOptNoBlock = 3,
-         FailOnOptIP6Only = 4,
-         FailOnBind       = 5,
-         FailOnListen     = 6
+         OK                 = 0,
+         NotClosed          = 1,
+         FailOnInit         = 2,
+         FailOnOptNoBlock   = 3,
+         FailOnOptIP6Only   = 4,
+         FailOnBind         = 5,
+         FailOnListen       = 6,
+         FailOnOptReusePort = 7
       };
 
       /// <summary>
@@ -107,6 +108,7 @@ namespace CppCore
          static constexpr bool LINGER    = true;
          static constexpr int  LTIME     = 2;
          static constexpr bool KEEPALIVE = true;
+         static constexpr bool REUSEPORT = false;
       };
 
       /// <summary>
@@ -127,6 +129,8 @@ namespace CppCore
       /// <summary>
       /// Tries to start listening on specififed 
       /// tcp port with specified options.
+      /// Enable reuseport to let several sockets listen on the
+      /// same port with the kernel distributing connections among them.
       /// </summary>
       INLINE ListenReturn listen(
          const uint16_t port,
@@ -134,7 +138,8 @@ namespace CppCore
          const bool     reuseaddr = ListenDefaults::REUSEADDR,
          const bool     linger    = ListenDefaults::LINGER,
          const int      ltime     = ListenDefaults::LTIME,
-         const bool     keepalive = ListenDefaults::KEEPALIVE)
+         const bool     keepalive = ListenDefaults::KEEPALIVE,
+         const bool     reuseport = ListenDefaults::REUSEPORT)
       {
          if (mSocket != INVALID_SOCKET)
             return ListenReturn::NotClosed;
@@ -172,6 +177,13 @@ namespace CppCore
          this->setOptionLinger(linger, ltime);
          this->setOptionKeepAlive(keepalive);
 
+         // required if requested: SO_REUSEPORT (must be set before bind)
+         if (reuseport && !this->setOptionReusePort(true))
+         {
+            this->close();
+            return ListenReturn::FailOnOptReusePort;
+         }
+
          // bind tcp socket
          if (SOCKET_ERROR == Socket::bind(mAddress))
          {
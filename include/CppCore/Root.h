@@ -698,6 +698,9 @@
 #ifndef CPPCORE_OS_WASI
 #include <netdb.h>
 #endif
+#if defined(CPPCORE_OS_LINUX) || defined(CPPCORE_OS_ANDROID)
+#include <sys/epoll.h>
+#endif
 #define SOCKET int
 #define INVALID_SOCKET  (SOCKET)(~0)
 #define SOCKET_ERROR    -1
@@ -998,6 +1001,7 @@ namespace CppCore
    using ::std::chrono::milliseconds;
    using ::std::chrono::microseconds;
    using ::std::chrono::nanoseconds;
+   using ::std::chrono::duration_cast;
    
    // for timestamps/dates (precision: seconds)
    using Clock     = system_clock;
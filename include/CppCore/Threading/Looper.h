@@ -13,7 +13,7 @@ namespace CppCore
    /// </summary>
    class Looper
    {
-      friend Schedule;
+      template<typename TTIMERS> friend class ScheduleT;
 
    protected:
       atomic<bool> mIsRunning;
@@ -136,9 +136,15 @@ namespace CppCore
          // save id of looper thread in case it's different from constructor
          mThreadId = ::std::this_thread::get_id();
 
+         // get a local run queue in the schedule
+         mSchedule.attach();
+
          // enter loop on executing schedule
          while (mIsRunning.load())
             mSchedule.execute(*this);
+
+         // hand back local run queue
+         mSchedule.detach();
       }
    };
 }
@@ -5,7 +5,18 @@
 #define CPPCORE_RUNNABLE_EXECUTE_TOLERANCE_US 10 
 #endif
 
+#ifndef CPPCORE_TIMERWHEEL_TICK_US
+// Tick length of a Runnable::TimerWheel in microseconds. Timers expire at the end of their tick.
+#define CPPCORE_TIMERWHEEL_TICK_US 1000
+#endif
+
+#ifndef CPPCORE_TIMERWHEEL_LEVELS
+// Levels with 64 slots each in a Runnable::TimerWheel, covering 64^LEVELS ticks.
+#define CPPCORE_TIMERWHEEL_LEVELS 4
+#endif
+
 #include <CppCore/Root.h>
+#include <CppCore/BitOps.h>
 #include <CppCore/Containers/MinHeap.h>
 
 namespace CppCore
@@ -15,7 +26,7 @@ namespace CppCore
    /// <summary>
    /// Forward Declaration
    /// </summary>
-   class Schedule;
+   template<typename TTIMERS> class ScheduleT;
 
    /// <summary>
    /// Runnables are used to execute a function in a looper at a given time.
@@ -23,7 +34,7 @@ namespace CppCore
    /// </summary>
    class CPPCORE_ALIGN16 Runnable
    {
-      friend Schedule;
+      template<typename TTIMERS> friend class ScheduleT;
 
    public:
       /// <summary>
@@ -31,6 +42,16 @@ namespace CppCore
       /// </summary>
       enum State { Idle, Scheduled, Starting, Running };
 
+      /// <summary>
+      /// Queue index of a Runnable scheduled in the shared queues of a Schedule.
+      /// </summary>
+      static constexpr size_t SHAREDQUEUE = numeric_limits<size_t>::max();
+
+      /// <summary>
+      /// Wheel slot of a Runnable not linked in a TimerWheel.
+      /// </summary>
+      static constexpr uint32_t NOWHEELSLOT = numeric_limits<uint32_t>::max();
+
    protected:
       RunnableFunction   mFunc;
       TimePointHR        mExecutionTime;
@@ -39,7 +60,11 @@ namespace CppCore
       CPPCORE_MUTEX_TYPE mMutex;
       bool               mRepeat;
       bool               mReschedule;
-
+      atomic<size_t>     mQueueIdx;
+      Runnable*          mWheelPrev;
+      Runnable*          mWheelNext;
+      uint64_t           mWheelTick;
+      uint32_t           mWheelSlot;
       
       /// <summary>
       /// Sets the time when to execute this runnable in the schedule
@@ -81,7 +106,12 @@ namespace CppCore
          mFunc(0),
          mRepeat(false),
          mInterval(DurationHR::zero()),
-         mReschedule(false) { CPPCORE_MUTEX_INIT(mMutex); }
+         mReschedule(false),
+         mQueueIdx(SHAREDQUEUE),
+         mWheelPrev(nullptr),
+         mWheelNext(nullptr),
+         mWheelTick(0),
+         mWheelSlot(NOWHEELSLOT) { CPPCORE_MUTEX_INIT(mMutex); }
 
       /// <summary>
       /// Runnable Constructor
@@ -92,7 +122,12 @@ namespace CppCore
          mFunc(func),
          mRepeat(false),
          mInterval(DurationHR::zero()),
-         mReschedule(false) { CPPCORE_MUTEX_INIT(mMutex); }
+         mReschedule(false),
+         mQueueIdx(SHAREDQUEUE),
+         mWheelPrev(nullptr),
+         mWheelNext(nullptr),
+         mWheelTick(0),
+         mWheelSlot(NOWHEELSLOT) { CPPCORE_MUTEX_INIT(mMutex); }
 
       /// <summary>
       /// Timer Constructor
@@ -103,7 +138,12 @@ namespace CppCore
          mFunc(func),
          mRepeat(true),
          mInterval(interval),
-         mReschedule(false) { CPPCORE_MUTEX_INIT(mMutex); }
+         mReschedule(false),
+         mQueueIdx(SHAREDQUEUE),
+         mWheelPrev(nullptr),
+         mWheelNext(nullptr),
+         mWheelTick(0),
+         mWheelSlot(NOWHEELSLOT) { CPPCORE_MUTEX_INIT(mMutex); }
 
       /// <summary>
       /// Destructor
@@ -293,6 +333,259 @@ namespace CppCore
             return CppCore::MinHeap::ST<T, SIZE, T>::template removeAll<
                Comparer>(key);
          }
+         INLINE bool remove(const T& item)
+         {
+            T tmp;
+            return removeOne(item, tmp);
+         }
+         INLINE bool popDue(T& item, const TimePointHR& now)
+         {
+            return 
+               this->peek(item) && 
+               item->getExecutionTime() - now < microseconds(CPPCORE_RUNNABLE_EXECUTE_TOLERANCE_US) &&
+               pop(item);
+         }
+         INLINE bool next(TimePointHR& time)
+         {
+            T item;
+            if (!this->peek(item))
+               return false;
+            time = item->getExecutionTime();
+            return true;
+         }
+      };
+
+      /////////////////////////////////////////////////////////////////////////////////
+
+      /// <summary>
+      /// Hierarchical Hashed Timing Wheel for Runnables.
+      /// Alternative to MinHeap with O(1) push and remove and without capacity limit.
+      /// Runnables are linked into one of 64 slots on one of LEVELS levels by their
+      /// own list pointers. Level L holds those due in the current 64^(L+1) tick block
+      /// and is cascaded to lower levels slot by slot as time advances.
+      /// Beyond 64^LEVELS ticks they wait in an overflow list.
+      /// Execution time is rounded up to the end of its tick.
+      /// </summary>
+      template<size_t LEVELS = CPPCORE_TIMERWHEEL_LEVELS, uint64_t TICKUS = CPPCORE_TIMERWHEEL_TICK_US>
+      class TimerWheel
+      {
+         static_assert(LEVELS > 0 && LEVELS * 6U < 64U);
+         static_assert(TICKUS > 0);
+
+      protected:
+         static constexpr uint32_t BITS     = 6U;
+         static constexpr uint32_t SLOTS    = 64U;
+         static constexpr uint32_t OVERSLOT = (uint32_t)(LEVELS * SLOTS);
+
+         Runnable* mSlots[LEVELS * SLOTS + 1U];
+         uint64_t  mUsed[LEVELS];
+         uint64_t  mTick;
+         size_t    mLength;
+
+         /// <summary>
+         /// Tick of a timepoint, rounded down or up
+         /// </summary>
+         template<bool UP>
+         INLINE static uint64_t toTick(const TimePointHR& time)
+         {
+            const int64_t US = duration_cast<microseconds>(time.time_since_epoch()).count();
+            return US <= 0 ? 0U : UP ? ((uint64_t)US + TICKUS - 1U) / TICKUS : (uint64_t)US / TICKUS;
+         }
+
+         /// <summary>
+         /// Start of a tick
+         /// </summary>
+         INLINE static TimePointHR toTime(const uint64_t tick)
+         {
+            return TimePointHR(duration_cast<DurationHR>(microseconds(tick * TICKUS)));
+         }
+
+         /// <summary>
+         /// Links item as first into slot
+         /// </summary>
+         INLINE void link(Runnable* item, const uint32_t slot)
+         {
+            Runnable*& head = mSlots[slot];
+            item->mWheelPrev = nullptr;
+            item->mWheelNext = head;
+            item->mWheelSlot = slot;
+            if (head) head->mWheelPrev = item;
+            head = item;
+            if (slot != OVERSLOT)
+               mUsed[slot / SLOTS] |= 1ULL << (slot % SLOTS);
+         }
+
+         /// <summary>
+         /// Unlinks item from its slot
+         /// </summary>
+         INLINE void unlink(Runnable* item)
+         {
+            const uint32_t slot = item->mWheelSlot;
+            if (item->mWheelNext) item->mWheelNext->mWheelPrev = item->mWheelPrev;
+            if (item->mWheelPrev) item->mWheelPrev->mWheelNext = item->mWheelNext;
+            else
+            {
+               mSlots[slot] = item->mWheelNext;
+               if (!item->mWheelNext && slot != OVERSLOT)
+                  mUsed[slot / SLOTS] &= ~(1ULL << (slot % SLOTS));
+            }
+            item->mWheelPrev = nullptr;
+            item->mWheelNext = nullptr;
+            item->mWheelSlot = NOWHEELSLOT;
+         }
+
+         /// <summary>
+         /// Links item into the slot for its tick. The level is given by
+         /// the highest 6 bit group in which its tick and the current one differ.
+         /// </summary>
+         INLINE void place(Runnable* item)
+         {
+            if (item->mWheelTick < mTick)
+               item->mWheelTick = mTick;
+            const uint64_t TICK = item->mWheelTick;
+            const uint64_t DIFF = TICK ^ mTick;
+            const uint32_t LVL  = DIFF ? (63U - lzcnt64(DIFF)) / BITS : 0U;
+            link(item, LVL >= LEVELS ? OVERSLOT : 
+               (uint32_t)(LVL * SLOTS + ((TICK >> (LVL * BITS)) & (SLOTS - 1U))));
+         }
+
+         /// <summary>
+         /// Moves all items of a slot to their new slots
+         /// </summary>
+         INLINE void cascade(const uint32_t slot)
+         {
+            Runnable* item = mSlots[slot];
+            mSlots[slot] = nullptr;
+            if (slot != OVERSLOT)
+               mUsed[slot / SLOTS] &= ~(1ULL << (slot % SLOTS));
+            while (item)
+            {
+               Runnable* next = item->mWheelNext;
+               place(item);
+               item = next;
+            }
+         }
+
+         /// <summary>
+         /// First tick after the current one with a used slot starting at it.
+         /// The slot of the current tick on the lowest level is not considered.
+         /// </summary>
+         INLINE uint64_t nextTick() const
+         {
+            for (uint32_t l = 0; l < LEVELS; l++)
+            {
+               const uint32_t SHIFT = l * BITS;
+               const uint32_t IDX   = (uint32_t)((mTick >> SHIFT) & (SLOTS - 1U));
+               const uint64_t USED  = IDX == SLOTS - 1U ? 0U : mUsed[l] & (~0ULL << (IDX + 1U));
+               if (USED)
+               {
+                  const uint64_t BLOCK = (mTick >> (SHIFT + BITS)) << (SHIFT + BITS);
+                  return BLOCK | ((uint64_t)tzcnt64(USED) << SHIFT);
+               }
+            }
+            if (mSlots[OVERSLOT])
+               return ((mTick >> (LEVELS * BITS)) + 1U) << (LEVELS * BITS);
+            return numeric_limits<uint64_t>::max();
+         }
+
+         /// <summary>
+         /// Advances the current tick to the next used one, but not beyond until.
+         /// Cascades the higher level slots starting at the new tick.
+         /// </summary>
+         INLINE void advance(const uint64_t until)
+         {
+            const uint64_t NEXT = nextTick();
+            if (NEXT > until)
+            {
+               mTick = until;
+               return;
+            }
+            mTick = NEXT;
+            if (!(NEXT & ((1ULL << (LEVELS * BITS)) - 1U)))
+               cascade(OVERSLOT);
+            for (uint32_t l = LEVELS - 1U; l > 0; l--)
+               if (!(NEXT & ((1ULL << (l * BITS)) - 1U)))
+                  cascade(l * SLOTS + (uint32_t)((NEXT >> (l * BITS)) & (SLOTS - 1U)));
+         }
+
+      public:
+         /// <summary>
+         /// Constructor
+         /// </summary>
+         INLINE TimerWheel() : 
+            mSlots(), 
+            mUsed(), 
+            mTick(toTick<false>(ClockHR::now())), 
+            mLength(0) { }
+
+         /// <summary>
+         /// Amount of linked Runnables
+         /// </summary>
+         INLINE size_t length() const { return mLength; }
+
+         /// <summary>
+         /// Links item for its execution time.
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE bool push(Runnable* item)
+         {
+            if (item->mWheelSlot != NOWHEELSLOT)
+               return false;
+            item->mWheelTick = toTick<true>(item->getExecutionTime());
+            place(item);
+            mLength++;
+            return true;
+         }
+
+         /// <summary>
+         /// Unlinks item using the slot stored in it.
+         /// Complexity: O(1)
+         /// </summary>
+         INLINE bool remove(Runnable* item)
+         {
+            if (item->mWheelSlot == NOWHEELSLOT)
+               return false;
+            unlink(item);
+            mLength--;
+            return true;
+         }
+
+         /// <summary>
+         /// Unlinks one item whose tick has fully passed at now.
+         /// Complexity: O(1) amortized
+         /// </summary>
+         INLINE bool popDue(Runnable*& item, const TimePointHR& now)
+         {
+            const uint64_t NOW = toTick<false>(now);
+            while (true)
+            {
+               if ((item = mSlots[mTick & (SLOTS - 1U)]))
+               {
+                  unlink(item);
+                  mLength--;
+                  return true;
+               }
+               if (mTick >= NOW || !mLength)
+               {
+                  if (mTick < NOW)
+                     mTick = NOW;
+                  return false;
+               }
+               advance(NOW);
+            }
+         }
+
+         /// <summary>
+         /// Earliest time the next item might be due.
+         /// Complexity: O(LEVELS)
+         /// </summary>
+         INLINE bool next(TimePointHR& time) const
+         {
+            if (!mLength)
+               return false;
+            time = toTime(mSlots[mTick & (SLOTS - 1U)] ? mTick : nextTick());
+            return true;
+         }
       };
    };
 }
@@ -16,6 +16,26 @@
 #define CPPCORE_DEFAULT_INSTANTTIMERCOUNT (4096U-3U) 
 #endif
 
+#ifndef CPPCORE_DEFAULT_WORKERCOUNT
+// Max. threads with an own local run queue in a Schedule, others only use the shared one
+#define CPPCORE_DEFAULT_WORKERCOUNT 64
+#endif
+
+#ifndef CPPCORE_DEFAULT_LOCALTIMERCOUNT
+// Max. instant runnables in the local run queue of a thread (-3 due to memory alignment)
+#define CPPCORE_DEFAULT_LOCALTIMERCOUNT (256U-3U)
+#endif
+
+#ifndef CPPCORE_DEFAULT_INSTANTBATCH
+// Max. instant runnables taken from the shared queue with one lock
+#define CPPCORE_DEFAULT_INSTANTBATCH 8
+#endif
+
+#ifndef CPPCORE_DEFAULT_LOCALPOLL
+// Max. runnables taken from the local run queue before looking at the shared ones
+#define CPPCORE_DEFAULT_LOCALPOLL 32
+#endif
+
 #ifndef CPPCORE_DEFAULT_SLEEP_MS
 // Default sleep time in milliseconds if no runnable is present in the Schedule
 #define CPPCORE_DEFAULT_SLEEP_MS 100
@@ -30,12 +50,55 @@
 namespace CppCore
 {
    /// <summary>
-   /// Multi-Thread Safe Schedule for Runnables
+   /// Multi-Thread Safe Schedule for Runnables.
+   /// Timers and instant runnables scheduled from foreign threads are kept in shared
+   /// containers guarded by one mutex. Each attached worker thread additionally owns
+   /// a local run queue for instant runnables it schedules itself. Idle workers steal
+   /// from the local queues of others.
+   /// Timers are kept in TTIMERS, a Runnable::MinHeap with exact ordering
+   /// or a Runnable::TimerWheel with O(1) schedule and cancel.
+   /// Use Schedule unless you need a specific one.
    /// </summary>
-   class CPPCORE_ALIGN64 Schedule : public Handler
+   template<typename TTIMERS>
+   class CPPCORE_ALIGN64 ScheduleT : public Handler
    {
-      typedef Runnable::MinHeap<CPPCORE_DEFAULT_TIMERCOUNT>           RunnablePriorityQueue;
+      typedef TTIMERS                                                 RunnablePriorityQueue;
       typedef Queue::ST<Runnable*, CPPCORE_DEFAULT_INSTANTTIMERCOUNT> RunnableQueue;
+      typedef Queue::ST<Runnable*, CPPCORE_DEFAULT_LOCALTIMERCOUNT>   RunnableQueueLocal;
+
+   protected:
+      /// <summary>
+      /// Local run queue of an attached worker thread
+      /// </summary>
+      class CPPCORE_ALIGN64 Worker
+      {
+      public:
+         CPPCORE_MUTEX_TYPE mMutex;
+         RunnableQueueLocal mQueue;
+         atomic<size_t>     mLength;
+         atomic<bool>       mUsed;
+         size_t             mNumLocal;
+         INLINE Worker() : mLength(0), mUsed(false), mNumLocal(0) { CPPCORE_MUTEX_INIT(mMutex); }
+         INLINE ~Worker() { CPPCORE_MUTEX_DELETE(mMutex); }
+      };
+
+      /// <summary>
+      /// Schedule and worker index the calling thread is attached to
+      /// </summary>
+      struct ThreadLocal
+      {
+         ScheduleT* schedule;
+         size_t     idx;
+      };
+
+      /// <summary>
+      /// Returns the attachment of the calling thread
+      /// </summary>
+      INLINE static ThreadLocal& getThreadLocal()
+      {
+         static thread_local ThreadLocal tl = { nullptr, 0 };
+         return tl;
+      }
 
    protected:
       CPPCORE_ALIGN64 RunnablePriorityQueue  mTimers;
@@ -44,16 +107,183 @@ namespace CppCore
       condition_variable mCondSleep;
       const DurationHR   mDefaultSleep;
       const DurationHR   mSleepThreshold;
+      atomic<size_t>     mNumWorkers;
+      atomic<size_t>     mNumSleeping;
+      CPPCORE_ALIGN64 Worker mWorkers[CPPCORE_DEFAULT_WORKERCOUNT];
+
+      /// <summary>
+      /// Returns the local worker of the calling thread or nullptr if not attached.
+      /// </summary>
+      INLINE Worker* getLocalWorker()
+      {
+         const ThreadLocal& tl = getThreadLocal();
+         return tl.schedule == this ? &mWorkers[tl.idx] : nullptr;
+      }
+
+      /// <summary>
+      /// True if any local run queue has pending runnables (unlocked)
+      /// </summary>
+      INLINE bool hasLocal() const
+      {
+         const size_t NUM = mNumWorkers.load(::std::memory_order_relaxed);
+         for (size_t i = 0; i < NUM; i++)
+            if (mWorkers[i].mLength.load(::std::memory_order_relaxed))
+               return true;
+         return false;
+      }
+
+      /// <summary>
+      /// Pops the next runnable from a local run queue and marks it as starting.
+      /// </summary>
+      INLINE bool popLocal(Worker& w, Runnable*& runnable)
+      {
+         bool ok = false;
+         if (w.mLength.load(::std::memory_order_relaxed))
+         {
+            CPPCORE_MUTEX_LOCK(w.mMutex);
+            if (w.mQueue.popFront(runnable))
+            {
+               runnable->setState(Runnable::State::Starting);
+               w.mLength.store(w.mQueue.length(), ::std::memory_order_relaxed);
+               ok = true;
+            }
+            CPPCORE_MUTEX_UNLOCK(w.mMutex);
+         }
+         return ok;
+      }
+
+      /// <summary>
+      /// Tries to steal a runnable from the local run queue of another worker.
+      /// </summary>
+      INLINE bool steal(const Worker* self, Runnable*& runnable)
+      {
+         const size_t NUM   = mNumWorkers.load(::std::memory_order_relaxed);
+         const size_t START = self ? (size_t)(self - mWorkers) + 1U : 0U;
+         for (size_t i = 0; i < NUM; i++)
+         {
+            Worker& victim = mWorkers[(START + i) % NUM];
+            if (&victim != self && popLocal(victim, runnable))
+               return true;
+         }
+         return false;
+      }
+
+      /// <summary>
+      /// Removes a scheduled instant runnable from the queue it's in.
+      /// Runnable must be locked.
+      /// </summary>
+      INLINE bool cancelInstant(Runnable& runnable)
+      {
+         Runnable* tmp;
+         while (true)
+         {
+            // queue the runnable is in (can move from shared to local by batching)
+            const size_t IDX = runnable.mQueueIdx.load();
+            bool ok = false;
+
+            if (IDX == Runnable::SHAREDQUEUE)
+            {
+               unique_lock<mutex> l(mMutexTimers);
+               if (!runnable.isScheduled())
+                  return false;
+               ok = mTimersInstant.removeOneUnsorted(&runnable, tmp);
+               if (ok)
+                  runnable.setState(Runnable::State::Idle);
+            }
+            else
+            {
+               Worker& w = mWorkers[IDX];
+               CPPCORE_MUTEX_LOCK(w.mMutex);
+               if (!runnable.isScheduled())
+               {
+                  CPPCORE_MUTEX_UNLOCK(w.mMutex);
+                  return false;
+               }
+               ok = w.mQueue.removeOneUnsorted(&runnable, tmp);
+               if (ok)
+               {
+                  runnable.setState(Runnable::State::Idle);
+                  w.mLength.store(w.mQueue.length(), ::std::memory_order_relaxed);
+               }
+               CPPCORE_MUTEX_UNLOCK(w.mMutex);
+            }
+
+            // done unless it was moved meanwhile
+            if (ok || IDX == runnable.mQueueIdx.load())
+               return ok;
+         }
+      }
+
+      /// <summary>
+      /// Wakes one sleeping thread after a push to a local run queue.
+      /// These pushes don't take the shared lock, so a thread could otherwise
+      /// check the local queues and then go to sleep right before the notify.
+      /// Pairs with the fence in execute(TLOOPER&).
+      /// </summary>
+      INLINE void wakeOneLocal()
+      {
+         ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+         if (mNumSleeping.load(::std::memory_order_relaxed))
+         {
+            // a thread about to sleep holds the lock until it waits
+            mMutexTimers.lock();
+            mMutexTimers.unlock();
+            mCondSleep.notify_one();
+         }
+      }
+
+      /// <summary>
+      /// Executes a runnable that was taken from a queue and set to starting.
+      /// Reschedules it afterwards if it repeats or was scheduled while running.
+      /// </summary>
+      INLINE void run(Runnable& runnable)
+      {
+         // execute it (this must not be inside a lock or else will block badly!)
+         runnable.setState(Runnable::State::Running);
+         runnable.execute();
+
+         // lock runnable here before switching to idle
+         runnable.lock();
+         runnable.setState(Runnable::State::Idle);
+
+         // reschedule repeating runnables
+         if (runnable.isRepeat())
+         {
+            // preferred next execution
+            const TimePointHR nextRun =
+               runnable.getExecutionTime() +
+               runnable.getInterval();
+
+            // unlock
+            runnable.unlock();
+
+            // reschedule timer, but not too much in the past
+            // else a late one would try to repeat itself a lot
+            schedule(runnable, std::max(nextRun, ClockHR::now()));
+         }
+
+         // reschedule instant runnables if schedule was called while running
+         else if (runnable.isReschedule())
+         {
+            runnable.setReschedule(false);
+            runnable.unlock();
+            schedule(runnable);
+         }
+         else
+            runnable.unlock();
+      }
 
    public:
       /// <summary>
       /// Constructor
       /// </summary>
-      INLINE Schedule(
+      INLINE ScheduleT(
          const DurationHR& defaultSleep   = milliseconds(CPPCORE_DEFAULT_SLEEP_MS),
          const DurationHR& sleepThreshold = microseconds(CPPCORE_DEFAULT_SLEEP_THRESHOLD_US)) :
          mDefaultSleep(defaultSleep),
-         mSleepThreshold(sleepThreshold) { }
+         mSleepThreshold(sleepThreshold),
+         mNumWorkers(0),
+         mNumSleeping(0) { }
 
       /// <summary>
       /// Wakes one sleeping thread (if any)
@@ -71,14 +301,96 @@ namespace CppCore
          mCondSleep.notify_all();
       }
 
+      /// <summary>
+      /// Attaches the calling thread as worker with an own local run queue.
+      /// Returns false if all worker slots are in use, the thread then only uses the shared queues.
+      /// </summary>
+      INLINE bool attach()
+      {
+         ThreadLocal& tl = getThreadLocal();
+         if (tl.schedule == this)
+            return true;
+
+         for (size_t i = 0; i < CPPCORE_DEFAULT_WORKERCOUNT; i++)
+         {
+            bool expected = false;
+            if (mWorkers[i].mUsed.compare_exchange_strong(expected, true))
+            {
+               // raise highwater mark of used workers
+               size_t num = mNumWorkers.load();
+               while (num < i + 1U && !mNumWorkers.compare_exchange_weak(num, i + 1U)) { }
+
+               tl.schedule = this;
+               tl.idx = i;
+               return true;
+            }
+         }
+         return false;
+      }
+
+      /// <summary>
+      /// Detaches the calling thread. Runnables left in its local run queue are
+      /// moved to the shared queue. Those that don't fit anymore are executed
+      /// on the calling thread before it returns.
+      /// </summary>
+      INLINE void detach()
+      {
+         ThreadLocal& tl = getThreadLocal();
+         if (tl.schedule != this)
+            return;
+
+         Worker& w = mWorkers[tl.idx];
+         Runnable* runnable = nullptr;
+
+         // reschedules from here on go to the shared queues
+         tl.schedule = nullptr;
+
+         while (true)
+         {
+            bool full = false;
+
+            // same lock order as in execute()
+            unique_lock<mutex> l(mMutexTimers);
+            CPPCORE_MUTEX_LOCK(w.mMutex);
+            while (w.mQueue.peekFront(runnable))
+            {
+               if (!mTimersInstant.pushBack(runnable))
+               {
+                  // shared queue is full, take this one to run it here
+                  w.mQueue.popFront(runnable);
+                  runnable->setState(Runnable::State::Starting);
+                  full = true;
+                  break;
+               }
+               w.mQueue.popFront(runnable);
+               runnable->mQueueIdx.store(Runnable::SHAREDQUEUE);
+            }
+            w.mLength.store(w.mQueue.length(), ::std::memory_order_relaxed);
+            CPPCORE_MUTEX_UNLOCK(w.mMutex);
+            l.unlock();
+
+            if (!full)
+               break;
+
+            // let the others work on the shared queue meanwhile
+            wakeAll();
+            run(*runnable);
+         }
+
+         w.mUsed.store(false);
+         wakeAll();
+      }
+
       /// <summary>
       /// Tries to add a Runnable to this Schedule executing at given absolute timepoint.
+      /// Instant runnables scheduled from an attached worker go to its local run queue
+      /// without touching the shared lock.
       /// </summary>
       INLINE virtual bool schedule(Runnable& runnable, const TimePointHR executeAt) override
       {
-         bool ok = false;                    // default return
-         runnable.lock();                    // first lock runnable (lower scope)
-         unique_lock<mutex> l(mMutexTimers); // then lock schedule (greater scope)
+         bool ok = false;     // default return
+         bool local = false;  // pushed to local run queue
+         runnable.lock();     // first lock runnable (lower scope)
 
          // get runnable state
          const Runnable::State STATE = runnable.getState();
@@ -93,17 +405,48 @@ namespace CppCore
             // set execution time of runnable
             runnable.setExecutionTime(executeAt);
 
-            // schedule instant runnables in the fifo queue O(1)
-            // others in the minheap O(log(n))
-            ok = runnable.isInstant() ?
-               mTimersInstant.pushBack(&runnable) :
-               mTimers.push(&runnable);
+            if (runnable.isInstant())
+            {
+               // try local run queue of calling thread first O(1)
+               if (Worker* w = getLocalWorker())
+               {
+                  CPPCORE_MUTEX_LOCK(w->mMutex);
+                  ok = local = w->mQueue.pushBack(&runnable);
+                  if (ok)
+                  {
+                     runnable.mQueueIdx.store((size_t)(w - mWorkers));
+                     runnable.setState(Runnable::State::Scheduled);
+                     w->mLength.store(w->mQueue.length(), ::std::memory_order_relaxed);
+                  }
+                  CPPCORE_MUTEX_UNLOCK(w->mMutex);
+               }
+
+               // else in the shared fifo queue O(1)
+               if (!ok)
+               {
+                  unique_lock<mutex> l(mMutexTimers);
+                  ok = mTimersInstant.pushBack(&runnable);
+                  if (ok)
+                  {
+                     runnable.mQueueIdx.store(Runnable::SHAREDQUEUE);
+                     runnable.setState(Runnable::State::Scheduled);
+                  }
+               }
+            }
 
-            // update scheduled state
-            if (ok)
-               runnable.setState(Runnable::State::Scheduled);
+            // others in the shared minheap O(log(n)) or timer wheel O(1)
+            else
+            {
+               unique_lock<mutex> l(mMutexTimers);
+               ok = mTimers.push(&runnable);
+               if (ok)
+               {
+                  runnable.mQueueIdx.store(Runnable::SHAREDQUEUE);
+                  runnable.setState(Runnable::State::Scheduled);
+               }
+            }
          }
-         
+
          // in execution (TODO: Instants only?)
          else if (STATE == Runnable::State::Starting || STATE == Runnable::State::Running)
          {
@@ -111,9 +454,12 @@ namespace CppCore
             ok = true;                     // success return
          }
 
-         l.unlock();        // unlock schedule
          runnable.unlock(); // unlock runnable
-         if (ok) wakeOne(); // wake one sleeping thread
+
+         // wake one sleeping thread
+         if (local) wakeOneLocal();
+         else if (ok) wakeOne();
+
          return ok;         // return whether it was scheduled or not
       }
 
@@ -127,30 +473,29 @@ namespace CppCore
       /// </summary>
       INLINE virtual bool cancel(Runnable& runnable) override
       {
-         bool ok = false;                    // default return
-         runnable.lock();                    // first lock runnable (lower scope)
-         unique_lock<mutex> l(mMutexTimers); // then lock schedule (greater scope)
+         bool ok = false;   // default return
+         runnable.lock();   // first lock runnable (lower scope)
 
          // must be scheduled to cancel
          if (runnable.isScheduled())
          {
-            Runnable* tmp;
+            // try find and remove it either from a fifo queue O(n)
+            if (runnable.isInstant())
+               ok = cancelInstant(runnable);
 
-            // try find and remove it either from fifo queue O(n)
-            // or minheap also O(n)
-            ok = runnable.isInstant() ?
-               mTimersInstant.removeOneUnsorted(&runnable, tmp) :
-               mTimers.removeOne(&runnable, tmp);
-
-            // update scheduled state
-            if (ok)
-               runnable.setState(Runnable::State::Idle);
+            // or minheap also O(n) or timer wheel O(1)
+            else
+            {
+               unique_lock<mutex> l(mMutexTimers);
+               ok = runnable.isScheduled() && mTimers.remove(&runnable);
+               if (ok)
+                  runnable.setState(Runnable::State::Idle);
+            }
          }
 
          if (runnable.isReschedule())
             runnable.setReschedule(false);
 
-         l.unlock();        // unlock schedule
          runnable.unlock(); // unlock runnable
          return ok;         // return whether it was canceled or not
       }
@@ -162,63 +507,68 @@ namespace CppCore
       INLINE bool execute()
       {
          Runnable* runnable = nullptr;
+         Worker*   w = getLocalWorker();
 
          ///////////////////////////////////////////////////////////////////////////////////////////
-         // (1) Get a Runnable to execute (locked schedule)
+         // (1) Get a Runnable to execute
 
-         // lock schedule
-         unique_lock<mutex> l(mMutexTimers);
+         // a) local run queue of attached thread (no shared lock), but
+         //    look at the shared queues first every now and then so
+         //    self rescheduling runnables can't starve instants and timers
+         bool ok = w && w->mNumLocal++ < CPPCORE_DEFAULT_LOCALPOLL && popLocal(*w, runnable);
 
-         // try to get an instant runnable first, otherwise try to get a normal runnable
-         const bool ok = mTimersInstant.popFront(runnable) ||
-            (mTimers.peek(runnable) && runnable->isTimeToExecute() && mTimers.pop(runnable));
+         // b) shared queues (locked schedule)
+         if (!ok)
+         {
+            // reset local counter
+            if (w)
+               w->mNumLocal = 0;
 
-         if (ok)
-            runnable->setState(Runnable::State::Starting);
+            // lock schedule
+            unique_lock<mutex> l(mMutexTimers);
 
-         // unlock schedule
-         l.unlock();
+            // try to get an instant runnable first, otherwise try to get a normal runnable
+            ok = mTimersInstant.popFront(runnable) ||
+               mTimers.popDue(runnable, ClockHR::now());
 
-         ///////////////////////////////////////////////////////////////////////////////////////////
-         // (2) Execute the Runnable if any (unlocked schedule)
+            if (ok)
+               runnable->setState(Runnable::State::Starting);
 
-         if (ok)
-         {
-            // execute it (this must not be inside a lock or else will block badly!)
-            runnable->setState(Runnable::State::Running);
-            runnable->execute();
-            
-            // lock runnable here before switching to idle
-            runnable->lock();
-            runnable->setState(Runnable::State::Idle);
-
-            // reschedule repeating runnables
-            if (runnable->isRepeat())
+            // take a batch of further instant runnables into the local queue with the same lock
+            if (ok && w && mTimersInstant.length())
             {
-               // preferred next execution
-               const TimePointHR nextRun =
-                  runnable->getExecutionTime() +
-                  runnable->getInterval();
-
-               // unlock
-               runnable->unlock();
-
-               // reschedule timer, but not too much in the past
-               // else a late one would try to repeat itself a lot
-               schedule(*runnable, std::max(nextRun, ClockHR::now()));
+               Runnable* next;
+               CPPCORE_MUTEX_LOCK(w->mMutex);
+               for (size_t i = 1;
+                  i < CPPCORE_DEFAULT_INSTANTBATCH &&
+                  w->mQueue.length() < w->mQueue.size() &&
+                  mTimersInstant.popFront(next); i++)
+               {
+                  w->mQueue.pushBack(next);
+                  next->mQueueIdx.store((size_t)(w - mWorkers));
+               }
+               w->mLength.store(w->mQueue.length(), ::std::memory_order_relaxed);
+               CPPCORE_MUTEX_UNLOCK(w->mMutex);
             }
 
-            // reschedule instant runnables if schedule was called while running
-            else if (runnable->isReschedule())
-            {
-               runnable->setReschedule(false);
-               runnable->unlock();
-               schedule(*runnable);
-            }
-            else
-               runnable->unlock();
+            // unlock schedule
+            l.unlock();
          }
 
+         // c) local run queue if skipped above
+         if (!ok && w)
+            ok = popLocal(*w, runnable);
+
+         // d) steal from other local run queues
+         if (!ok)
+            ok = steal(w, runnable);
+
+         ///////////////////////////////////////////////////////////////////////////////////////////
+         // (2) Execute the Runnable if any (unlocked schedule)
+
+         if (ok)
+            run(*runnable);
+
          return ok;
       }
 
@@ -233,8 +583,10 @@ namespace CppCore
          Runnable* runnable = nullptr;
 
          ///////////////////////////////////////////////////////////////////////////////////////////
-         // (1) Execute next runnable if any
-         execute();
+         // (1) Execute next runnable if any, don't think about sleeping while
+         //     there might be more (unlocked)
+         if (execute() || hasLocal())
+            return;
 
          ///////////////////////////////////////////////////////////////////////////////////////////
          // (2) See how long we can sleep/wait (locked)
@@ -242,17 +594,37 @@ namespace CppCore
          // lock schedule
          unique_lock<mutex> l(mMutexTimers);
 
+         // announce sleeping before looking at the local run queues. these are
+         // pushed without the shared lock, the fence pairs with the one in
+         // wakeOneLocal() so either we see the push or the pusher sees us.
+         mNumSleeping.fetch_add(1U, ::std::memory_order_relaxed);
+         ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+
+         // never sleep while local run queues have pending runnables,
+         // check again since one might have been pushed meanwhile
+         if (hasLocal())
+         {
+            mNumSleeping.fetch_sub(1U, ::std::memory_order_relaxed);
+            return;
+         }
+
+         // execution time of next instant runnable or timer
+         TimePointHR next;
+         bool hasNext = mTimersInstant.peekFront(runnable);
+         if (hasNext) next = runnable->getExecutionTime();
+         else hasNext = mTimers.next(next);
+
          // a) Based on next Runnable to execute
-         if (mTimersInstant.peekFront(runnable) || mTimers.peek(runnable))
+         if (hasNext)
          {
-            const DurationHR& timeLeft = runnable->getRemainingTime();
+            const DurationHR timeLeft = next - ClockHR::now();
 
             // only go to sleep if next task is above threshold ahead (can't properly sleep for < ~1ms without missing time)
             // note: wait_for and wait_until unlock on execution and lock on return
             if (timeLeft > mSleepThreshold)
             {
                looper.setExecuting(false);
-               cv_status cvstat = mCondSleep.wait_until(l, runnable->getExecutionTime());
+               mCondSleep.wait_until(l, next);
                looper.setExecuting(true);
             }
 
@@ -273,12 +645,28 @@ namespace CppCore
          else
          {
             looper.setExecuting(false);
-            cv_status cvstat = mCondSleep.wait_for(l, mDefaultSleep);
+            mCondSleep.wait_for(l, mDefaultSleep);
             looper.setExecuting(true);
          }
 
          // unlock schedule
+         mNumSleeping.fetch_sub(1U, ::std::memory_order_relaxed);
          l.unlock();
       }
    };
+
+   /// <summary>
+   /// Default Schedule. Timers are kept in a MinHeap with exact ordering or
+   /// in a TimerWheel if CPPCORE_SCHEDULE_TIMERWHEEL is defined.
+   /// </summary>
+   class CPPCORE_ALIGN64 Schedule : public ScheduleT<
+#if defined(CPPCORE_SCHEDULE_TIMERWHEEL)
+      Runnable::TimerWheel<>>
+#else
+      Runnable::MinHeap<CPPCORE_DEFAULT_TIMERCOUNT>>
+#endif
+   {
+   public:
+      using ScheduleT::ScheduleT;
+   };
 }
@@ -0,0 +1,77 @@
+#include "Benchmark.h"
+#include <CppCore/Crypto/AES.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SMALL 1024U
+#define LARGE 16384U
+//------------------------------------------------------------------------------------------------------------------------//
+CPPCORE_ALIGN64 static uint8_t KEY[32];
+CPPCORE_ALIGN64 static uint8_t IV[16];
+CPPCORE_ALIGN64 static uint8_t TAG[16];
+CPPCORE_ALIGN64 static uint8_t AAD[16];
+CPPCORE_ALIGN64 static uint8_t SRC[LARGE];
+CPPCORE_ALIGN64 static uint8_t DST[LARGE];
+//------------------------------------------------------------------------------------------------------------------------//
+template<typename AES>
+static INLINE void ecb(size_t n, size_t len)
+{
+   AES aes(KEY);
+   for (size_t i = 0; i < n; i++) {
+      aes.encryptECB(SRC, DST, len / 16U);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename AES>
+static INLINE void cbcenc(size_t n, size_t len)
+{
+   AES aes(KEY);
+   for (size_t i = 0; i < n; i++) {
+      aes.encryptCBC(SRC, DST, IV, len / 16U);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename AES>
+static INLINE void cbcdec(size_t n, size_t len)
+{
+   AES aes(KEY);
+   for (size_t i = 0; i < n; i++) {
+      aes.decryptCBC(SRC, DST, IV, len / 16U);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename AES>
+static INLINE void ctr(size_t n, size_t len)
+{
+   AES aes(KEY, false);
+   for (size_t i = 0; i < n; i++) {
+      aes.encryptCTR(SRC, DST, IV, len);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename GCM>
+static INLINE void gcm(size_t n, size_t len)
+{
+   GCM gcm(KEY);
+   for (size_t i = 0; i < n; i++) {
+      gcm.encrypt(IV, AAD, sizeof(AAD), SRC, DST, len, TAG);
+      CppCore::Benchmark::clobber();
+   }
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(AES, AES128_key, 0)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::AES128 aes(KEY);
+      CppCore::Benchmark::donotoptimize(aes);
+   }
+}
+CPPCORE_BENCHMARK(AES, AES128_ECB_16K,       LARGE) { ecb   <CppCore::AES128>(n, LARGE);     }
+CPPCORE_BENCHMARK(AES, AES128_CBC_enc_16K,   LARGE) { cbcenc<CppCore::AES128>(n, LARGE);     }
+CPPCORE_BENCHMARK(AES, AES128_CBC_dec_16K,   LARGE) { cbcdec<CppCore::AES128>(n, LARGE);     }
+CPPCORE_BENCHMARK(AES, AES128_CTR_1K,        SMALL) { ctr   <CppCore::AES128>(n, SMALL);     }
+CPPCORE_BENCHMARK(AES, AES128_CTR_16K,       LARGE) { ctr   <CppCore::AES128>(n, LARGE);     }
+CPPCORE_BENCHMARK(AES, AES256_CTR_16K,       LARGE) { ctr   <CppCore::AES256>(n, LARGE);     }
+CPPCORE_BENCHMARK(AES, AES128_GCM_1K,        SMALL) { gcm   <CppCore::AES128GCM>(n, SMALL);  }
+CPPCORE_BENCHMARK(AES, AES128_GCM_16K,       LARGE) { gcm   <CppCore::AES128GCM>(n, LARGE);  }
+CPPCORE_BENCHMARK(AES, AES256_GCM_16K,       LARGE) { gcm   <CppCore::AES256GCM>(n, LARGE);  }
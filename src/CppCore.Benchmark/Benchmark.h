@@ -0,0 +1,355 @@
+#pragma once
+
+#include <CppCore/Root.h>
+#include <CppCore/CPUID.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace CppCore { namespace Benchmark
+{
+   /// <summary>
+   /// Benchmark function. Must run the measured operation exactly n times.
+   /// </summary>
+   typedef void(*Function)(size_t n);
+
+   /// <summary>
+   /// Keeps the compiler from optimizing away the computation of v.
+   /// </summary>
+   template<typename T>
+   FORCEINLINE void donotoptimize(const T& v)
+   {
+   #if defined(CPPCORE_COMPILER_MSVC)
+      const volatile char* p = (const volatile char*)&v; (void)*p;
+      _ReadWriteBarrier();
+   #else
+      asm volatile("" : : "r,m"(v) : "memory");
+   #endif
+   }
+
+   /// <summary>
+   /// Forces all pending writes to memory to be considered observable.
+   /// </summary>
+   FORCEINLINE void clobber()
+   {
+   #if defined(CPPCORE_COMPILER_MSVC)
+      _ReadWriteBarrier();
+   #else
+      asm volatile("" : : : "memory");
+   #endif
+   }
+
+   /// <summary>
+   /// Reads the timestamp counter or returns 0 where there is none.
+   /// </summary>
+   FORCEINLINE uint64_t cycles()
+   {
+   #if defined(CPPCORE_CPU_X86ORX64)
+      return (uint64_t)__rdtsc();
+   #else
+      return 0U;
+   #endif
+   }
+
+   /// <summary>
+   /// Registered Benchmark
+   /// </summary>
+   class Entry
+   {
+   public:
+      std::string suite; // e.g. Hash
+      std::string name;  // e.g. CRC32C_4K
+      size_t      bytes; // bytes processed per iteration, 0 if not applicable
+      size_t      ops;   // operations per iteration
+      Function    func;  // runs n iterations
+   };
+
+   /// <summary>
+   /// Measured Benchmark
+   /// </summary>
+   class Result
+   {
+   public:
+      const Entry* entry;
+      size_t       iterations; // iterations per sample
+      size_t       samples;    // number of samples
+      double       median;     // median nanoseconds per iteration
+      double       p99;        // 99th percentile nanoseconds per iteration
+      double       min;        // fastest sample in nanoseconds per iteration
+      double       cycles;     // median timestamp counter cycles per iteration
+
+      /// <summary>
+      /// Timestamp counter cycles per processed byte or 0.
+      /// </summary>
+      INLINE double cyclesPerByte() const
+      {
+         return entry->bytes && cycles > 0.0 ? cycles / (double)entry->bytes : 0.0;
+      }
+
+      /// <summary>
+      /// Operations per second based on the median.
+      /// </summary>
+      INLINE double opsPerSecond() const
+      {
+         return median > 0.0 ? (double)entry->ops * 1e9 / median : 0.0;
+      }
+
+      /// <summary>
+      /// Bytes per second based on the median.
+      /// </summary>
+      INLINE double bytesPerSecond() const
+      {
+         return median > 0.0 ? (double)entry->bytes * 1e9 / median : 0.0;
+      }
+   };
+
+   /// <summary>
+   /// Global list of registered Benchmarks
+   /// </summary>
+   class Registry
+   {
+   public:
+      INLINE static std::vector<Entry>& get()
+      {
+         static std::vector<Entry> entries;
+         return entries;
+      }
+      INLINE static void add(const char* suite, const char* name, size_t bytes, size_t ops, Function func)
+      {
+         get().push_back(Entry{ suite, name, bytes, ops, func });
+      }
+      INLINE static void add(const std::string& suite, const std::string& name, size_t bytes, size_t ops, Function func)
+      {
+         get().push_back(Entry{ suite, name, bytes, ops, func });
+      }
+   };
+
+   /// <summary>
+   /// Registers a Benchmark from a static initializer.
+   /// </summary>
+   class Registrar
+   {
+   public:
+      INLINE Registrar(const char* suite, const char* name, size_t bytes, size_t ops, Function func)
+      {
+         Registry::add(suite, name, bytes, ops, func);
+      }
+   };
+
+   /// <summary>
+   /// Calibrates, warms up and samples Benchmarks.
+   /// </summary>
+   class Runner
+   {
+   public:
+      size_t warmup  = 100U; // milliseconds of warm-up per benchmark
+      size_t target  = 10U;  // milliseconds per sample
+      size_t samples = 31U;  // samples per benchmark
+
+      /// <summary>
+      /// Runs n iterations of e and returns elapsed nanoseconds and cycles.
+      /// </summary>
+      INLINE static void measure(const Entry& e, size_t n, double& ns, double& cyc)
+      {
+         const uint64_t    c1 = cycles();
+         const TimePointHR t1 = ClockHR::now();
+         e.func(n);
+         const TimePointHR t2 = ClockHR::now();
+         const uint64_t    c2 = cycles();
+         ns  = (double)::std::chrono::duration_cast<nanoseconds>(t2 - t1).count();
+         cyc = (double)(c2 - c1);
+      }
+
+      /// <summary>
+      /// Measures e. Doubles the iteration count until a sample takes the target time,
+      /// keeps running it for the warm-up time and then records the samples.
+      /// </summary>
+      INLINE Result run(const Entry& e) const
+      {
+         const double TARGET = (double)target * 1e6;
+         const double WARMUP = (double)warmup * 1e6;
+         double ns, cyc, total = 0.0;
+         size_t n = 1U;
+         while (true)
+         {
+            measure(e, n, ns, cyc);
+            total += ns;
+            if (ns >= TARGET || n >= ((size_t)1U << 40))
+               break;
+            n = ns > 0.0 && ns * 32.0 > TARGET ?
+               (size_t)((double)n * TARGET / ns) + 1U :
+               n * 32U;
+         }
+         while (total < WARMUP)
+         {
+            measure(e, n, ns, cyc);
+            total += ns;
+         }
+         const size_t NSAMPLES = samples ? samples : 1U;
+         std::vector<double> t(NSAMPLES);
+         std::vector<double> c(NSAMPLES);
+         for (size_t i = 0; i < NSAMPLES; i++)
+         {
+            measure(e, n, ns, cyc);
+            t[i] = ns  / (double)n;
+            c[i] = cyc / (double)n;
+         }
+         std::sort(t.begin(), t.end());
+         std::sort(c.begin(), c.end());
+         Result r;
+         r.entry      = &e;
+         r.iterations = n;
+         r.samples    = NSAMPLES;
+         r.median     = t[NSAMPLES / 2U];
+         r.p99        = t[std::min(NSAMPLES - 1U, (NSAMPLES * 99U + 99U) / 100U - 1U)];
+         r.min        = t[0];
+         r.cycles     = c[NSAMPLES / 2U];
+         return r;
+      }
+   };
+
+   /// <summary>
+   /// CPU features compiled in and supported at run-time.
+   /// </summary>
+   class Features
+   {
+   public:
+      std::string vendor;
+      std::string brand;
+      std::vector<const char*> compiled;
+      std::vector<const char*> supported;
+
+      INLINE Features()
+      {
+      #if defined(CPPCORE_CPU_X86ORX64)
+         typedef CPUID::Instruction I;
+         const CPUID cpu;
+         vendor = cpu.getVendor();
+         brand  = cpu.getBrand();
+         add(I::SSE2,       CPPCORE_CPUFEAT_SSE2_ENABLED,       cpu.SSE2());
+         add(I::SSSE3,      CPPCORE_CPUFEAT_SSSE3_ENABLED,      cpu.SSSE3());
+         add(I::SSE41,      CPPCORE_CPUFEAT_SSE41_ENABLED,      cpu.SSE41());
+         add(I::SSE42,      CPPCORE_CPUFEAT_SSE42_ENABLED,      cpu.SSE42());
+         add(I::POPCNT,     CPPCORE_CPUFEAT_POPCNT_ENABLED,     cpu.POPCNT());
+         add(I::PCLMUL,     CPPCORE_CPUFEAT_PCLMUL_ENABLED,     cpu.PCLMULQDQ());
+         add(I::AES,        CPPCORE_CPUFEAT_AES_ENABLED,        cpu.AES());
+         add(I::AVX,        CPPCORE_CPUFEAT_AVX_ENABLED,        cpu.AVX());
+         add(I::FMA3,       CPPCORE_CPUFEAT_FMA3_ENABLED,       cpu.FMA());
+         add(I::LZCNT,      CPPCORE_CPUFEAT_LZCNT_ENABLED,      cpu.LZCNT());
+         add(I::BMI1,       CPPCORE_CPUFEAT_BMI1_ENABLED,       cpu.BMI1());
+         add(I::BMI2,       CPPCORE_CPUFEAT_BMI2_ENABLED,       cpu.BMI2());
+         add(I::MOVBE,      CPPCORE_CPUFEAT_MOVBE_ENABLED,      cpu.MOVBE());
+         add(I::AVX2,       CPPCORE_CPUFEAT_AVX2_ENABLED,       cpu.AVX2());
+         add(I::ADX,        CPPCORE_CPUFEAT_ADX_ENABLED,        cpu.ADX());
+         add(I::SHA,        CPPCORE_CPUFEAT_SHA_ENABLED,        cpu.SHA());
+         add(I::AVX512F,    CPPCORE_CPUFEAT_AVX512F_ENABLED,    cpu.AVX512F());
+         add(I::AVX512VL,   CPPCORE_CPUFEAT_AVX512VL_ENABLED,   cpu.AVX512VL());
+         add(I::AVX512BW,   CPPCORE_CPUFEAT_AVX512BW_ENABLED,   cpu.AVX512BW());
+         add(I::AVX512DQ,   CPPCORE_CPUFEAT_AVX512DQ_ENABLED,   cpu.AVX512DQ());
+         add(I::AVX512VBMI, CPPCORE_CPUFEAT_AVX512VBMI_ENABLED, cpu.AVX512VBMI());
+         add(I::AVX512IFMA, CPPCORE_CPUFEAT_AVX512IFMA_ENABLED, cpu.AVX512IFMA());
+      #endif
+      }
+
+   protected:
+   #if defined(CPPCORE_CPU_X86ORX64)
+      INLINE void add(const CPUID::Instruction i, bool c, bool s)
+      {
+         if (c) compiled.push_back(CPUID::getName(i));
+         if (s) supported.push_back(CPUID::getName(i));
+      }
+   #endif
+   };
+
+   /// <summary>
+   /// Console and JSON output of Results
+   /// </summary>
+   class Report
+   {
+   public:
+      INLINE static void header(const std::string& suite)
+      {
+         ::printf("----------------------------------------------------------------------------------------------------------\n");
+         ::printf(" %-32s %12s %12s %12s %10s %12s %10s\n",
+            suite.c_str(), "median ns", "p99 ns", "min ns", "cyc/B", "ops/s", "MB/s");
+         ::printf("----------------------------------------------------------------------------------------------------------\n");
+      }
+      INLINE static void print(const Result& r)
+      {
+         ::printf(" %-32s %12.1f %12.1f %12.1f %10.3f %12.4g %10.1f\n",
+            r.entry->name.c_str(), r.median, r.p99, r.min,
+            r.cyclesPerByte(), r.opsPerSecond(), r.bytesPerSecond() / 1e6);
+         ::fflush(stdout);
+      }
+      INLINE static void escape(FILE* f, const std::string& s)
+      {
+         ::fputc('"', f);
+         for (const char c : s)
+         {
+            if (c == '"' || c == '\\') ::fprintf(f, "\\%c", c);
+            else if ((uint8_t)c < 0x20) ::fprintf(f, "\\u%04x", (uint32_t)(uint8_t)c);
+            else ::fputc(c, f);
+         }
+         ::fputc('"', f);
+      }
+      INLINE static void list(FILE* f, const std::vector<const char*>& v)
+      {
+         ::fputc('[', f);
+         for (size_t i = 0; i < v.size(); i++)
+         {
+            if (i) ::fputc(',', f);
+            escape(f, v[i]);
+         }
+         ::fputc(']', f);
+      }
+      INLINE static bool json(const char* file, const std::vector<Result>& results, const Features& cpu)
+      {
+         FILE* f = ::fopen(file, "w");
+         if (!f)
+            return false;
+         ::fprintf(f, "{\n  \"cpu\": {\n    \"vendor\": ");
+         escape(f, cpu.vendor);
+         ::fprintf(f, ",\n    \"brand\": ");
+         escape(f, cpu.brand);
+         ::fprintf(f, ",\n    \"compiled\": ");
+         list(f, cpu.compiled);
+         ::fprintf(f, ",\n    \"supported\": ");
+         list(f, cpu.supported);
+         ::fprintf(f, "\n  },\n  \"benchmarks\": [");
+         for (size_t i = 0; i < results.size(); i++)
+         {
+            const Result& r = results[i];
+            ::fprintf(f, "%s\n    {\"suite\": ", i ? "," : "");
+            escape(f, r.entry->suite);
+            ::fprintf(f, ", \"name\": ");
+            escape(f, r.entry->name);
+            ::fprintf(f,
+               ", \"bytes\": %" PRIu64 ", \"ops\": %" PRIu64
+               ", \"iterations\": %" PRIu64 ", \"samples\": %" PRIu64
+               ", \"median_ns\": %.3f, \"p99_ns\": %.3f, \"min_ns\": %.3f"
+               ", \"cycles\": %.3f, \"cycles_per_byte\": %.4f, \"ops_per_sec\": %.1f}",
+               (uint64_t)r.entry->bytes, (uint64_t)r.entry->ops,
+               (uint64_t)r.iterations, (uint64_t)r.samples,
+               r.median, r.p99, r.min,
+               r.cycles, r.cyclesPerByte(), r.opsPerSecond());
+         }
+         ::fprintf(f, "\n  ]\n}\n");
+         ::fclose(f);
+         return true;
+      }
+   };
+}}
+
+/// <summary>
+/// Defines and registers a Benchmark. The body runs the measured operation n times.
+/// BYTES is the number of bytes processed per iteration (0 if not applicable).
+/// </summary>
+#define CPPCORE_BENCHMARK(SUITE, NAME, BYTES)                                  \
+   static void CppCoreBenchmark_##SUITE##_##NAME(size_t n);                   \
+   static const ::CppCore::Benchmark::Registrar CppCoreRegistrar_##SUITE##_##NAME( \
+      #SUITE, #NAME, BYTES, 1U, &CppCoreBenchmark_##SUITE##_##NAME);          \
+   static void CppCoreBenchmark_##SUITE##_##NAME(size_t n)
@@ -0,0 +1,130 @@
+#include "Benchmark.h"
+#include <CppCore/Math/BigInt.h>
+#include <CppCore/Math/Util.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+using CppCore::uint256_t;
+using CppCore::uint512_t;
+using CppCore::uint1024_t;
+using CppCore::uint2048_t;
+using CppCore::uint4096_t;
+//------------------------------------------------------------------------------------------------------------------------//
+/// <summary>
+/// Fills v with deterministic pseudo random bits.
+/// Optionally makes v a full width odd or even modulus.
+/// </summary>
+template<typename UINT>
+static INLINE void fill(UINT& v, uint32_t seed, bool modulus = false, bool odd = true)
+{
+   uint32_t t[sizeof(UINT) / 4U];
+   for (size_t i = 0; i < sizeof(UINT) / 4U; i++)
+      t[i] = seed = seed * 1664525U + 1013904223U;
+   if (modulus)
+   {
+      t[0] = odd ? (t[0] | 1U) : (t[0] & ~1U);
+      t[sizeof(UINT) / 4U - 1U] |= 0x80000000U;
+   }
+   ::memcpy((void*)&v, t, sizeof(UINT));
+}
+template<typename UINT, typename UINTX2>
+static INLINE void mul(size_t n)
+{
+   UINT a, b; UINTX2 r;
+   fill(a, 1U); fill(b, 2U);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::umul(a, b, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT, typename UINTX2>
+static INLINE void mulk(size_t n)
+{
+   UINT a, b; UINTX2 r;
+   fill(a, 1U); fill(b, 2U);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::umulk(a, b, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT, typename UINTX2>
+static INLINE void square(size_t n)
+{
+   UINT a; UINTX2 r;
+   fill(a, 1U);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::usquare(a, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT, typename UINTX2>
+static INLINE void mod(size_t n)
+{
+   UINTX2 a; UINT m, r;
+   fill(a, 1U); fill(m, 2U, true);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::umod(r, a, m);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT>
+static INLINE void mulmod(size_t n)
+{
+   UINT a, b, m, r;
+   fill(a, 1U); fill(b, 2U); fill(m, 3U, true);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::umulmod(a, b, m, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT>
+static INLINE void mulmodbarrett(size_t n)
+{
+   UINT a, b, m, r;
+   fill(a, 1U); fill(b, 2U); fill(m, 3U, true);
+   CppCore::umod(a, a, m); CppCore::umod(b, b, m);
+   const CppCore::Barrett<UINT> br(m);
+   for (size_t i = 0; i < n; i++) {
+      br.mul(a, b, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<typename UINT>
+static INLINE void powmod(size_t n, bool odd)
+{
+   UINT a, b, m, r, t;
+   fill(a, 1U); fill(b, 2U); fill(m, 3U, true, odd);
+   for (size_t i = 0; i < n; i++) {
+      CppCore::clone(t, a);
+      CppCore::upowmod(t, b, m, r);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(BigInt, umul_256,          0) { mul<uint256_t,  uint512_t>(n);     }
+CPPCORE_BENCHMARK(BigInt, umul_1024,         0) { mul<uint1024_t, uint2048_t>(n);    }
+CPPCORE_BENCHMARK(BigInt, umul_2048,         0) { mul<uint2048_t, uint4096_t>(n);    }
+CPPCORE_BENCHMARK(BigInt, umulk_1024,        0) { mulk<uint1024_t, uint2048_t>(n);   }
+CPPCORE_BENCHMARK(BigInt, umulk_2048,        0) { mulk<uint2048_t, uint4096_t>(n);   }
+CPPCORE_BENCHMARK(BigInt, usquare_1024,      0) { square<uint1024_t, uint2048_t>(n); }
+CPPCORE_BENCHMARK(BigInt, usquare_2048,      0) { square<uint2048_t, uint4096_t>(n); }
+CPPCORE_BENCHMARK(BigInt, umod_512_256,      0) { mod<uint256_t,  uint512_t>(n);     }
+CPPCORE_BENCHMARK(BigInt, umod_2048_1024,    0) { mod<uint1024_t, uint2048_t>(n);    }
+CPPCORE_BENCHMARK(BigInt, umulmod_256,       0) { mulmod<uint256_t>(n);              }
+CPPCORE_BENCHMARK(BigInt, umulmod_1024,      0) { mulmod<uint1024_t>(n);             }
+CPPCORE_BENCHMARK(BigInt, umulmod_2048,      0) { mulmod<uint2048_t>(n);             }
+CPPCORE_BENCHMARK(BigInt, barrett_256,       0) { mulmodbarrett<uint256_t>(n);       }
+CPPCORE_BENCHMARK(BigInt, barrett_1024,      0) { mulmodbarrett<uint1024_t>(n);      }
+CPPCORE_BENCHMARK(BigInt, barrett_2048,      0) { mulmodbarrett<uint2048_t>(n);      }
+CPPCORE_BENCHMARK(BigInt, upowmod_256_odd,   0) { powmod<uint256_t>(n, true);        }
+CPPCORE_BENCHMARK(BigInt, upowmod_256_even,  0) { powmod<uint256_t>(n, false);       }
+CPPCORE_BENCHMARK(BigInt, upowmod_1024_odd,  0) { powmod<uint1024_t>(n, true);       }
+CPPCORE_BENCHMARK(BigInt, upowmod_1024_even, 0) { powmod<uint1024_t>(n, false);      }
+CPPCORE_BENCHMARK(BigInt, upowmod_2048_odd,  0) { powmod<uint2048_t>(n, true);       }
@@ -0,0 +1,166 @@
+#include "Benchmark.h"
+#include <CppCore/Encoding.h>
+#include <CppCore/Math/BigInt.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SMALL 1024U
+#define LARGE 65536U
+//------------------------------------------------------------------------------------------------------------------------//
+CPPCORE_ALIGN64 static uint8_t BIN[LARGE];
+CPPCORE_ALIGN64 static uint8_t OUT[LARGE];
+CPPCORE_ALIGN64 static char    TXT[LARGE*2U+4U];
+//------------------------------------------------------------------------------------------------------------------------//
+static INLINE void fill()
+{
+   for (size_t i = 0; i < LARGE; i++)
+      BIN[i] = (uint8_t)(i * 167U + 13U);
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(Encoding, Hex_encode_1K, SMALL)
+{
+   fill();
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Hex::encode(BIN, TXT, SMALL);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Hex_decode_1K, SMALL)
+{
+   fill();
+   CppCore::Hex::encode(BIN, TXT, SMALL);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::Hex::decode(TXT, (void*)OUT, SMALL*2U);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Base64_encode_1K, SMALL)
+{
+   fill();
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Base64::encode(BIN, SMALL, TXT);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Base64_encode_64K, LARGE)
+{
+   fill();
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Base64::encode(BIN, LARGE, TXT);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Base64_decode_1K, SMALL)
+{
+   fill();
+   CppCore::Base64::encode(BIN, SMALL, TXT);
+   const size_t LEN = CppCore::Base64::symbollength(SMALL);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::Base64::decode(TXT, LEN, (void*)OUT);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Base64_decode_64K, LARGE)
+{
+   fill();
+   CppCore::Base64::encode(BIN, LARGE, TXT);
+   const size_t LEN = CppCore::Base64::symbollength(LARGE);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::Base64::decode(TXT, LEN, (void*)OUT);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Decimal_tostring_u64, 0)
+{
+   uint64_t v = 0x0123456789ABCDEFULL;
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Decimal::tostring(v, TXT);
+      CppCore::Benchmark::clobber();
+      v += 0x9E3779B97F4A7C15ULL;
+   }
+}
+CPPCORE_BENCHMARK(Encoding, Decimal_parse_u64, 0)
+{
+   CppCore::Decimal::tostring(uint64_t(0xFEDCBA9876543210ULL), TXT);
+   for (size_t i = 0; i < n; i++) {
+      uint64_t r = CppCore::Decimal::parse64u(TXT);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_tostring_u1024, 0)
+{
+   fill();
+   CppCore::uint1024_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   for (size_t i = 0; i < n; i++) {
+      CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 10U, CPPCORE_ALPHABET_B10, true);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_tostring_u4096, 0)
+{
+   fill();
+   CppCore::uint4096_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   for (size_t i = 0; i < n; i++) {
+      CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 10U, CPPCORE_ALPHABET_B10, true);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_tostring_u4096_b62, 0)
+{
+   fill();
+   CppCore::uint4096_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   for (size_t i = 0; i < n; i++) {
+      CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 62U, CPPCORE_ALPHABET_B62, true);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_parse_u1024, 0)
+{
+   fill();
+   CppCore::uint1024_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 10U, CPPCORE_ALPHABET_B10, true);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::BaseX::tryparse(TXT, v, CPPCORE_ALPHABET_B10);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::donotoptimize(v);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_parse_u4096, 0)
+{
+   fill();
+   CppCore::uint4096_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 10U, CPPCORE_ALPHABET_B10, true);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::BaseX::tryparse(TXT, v, CPPCORE_ALPHABET_B10);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::donotoptimize(v);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, BaseX_parse_u4096_b62, 0)
+{
+   fill();
+   CppCore::uint4096_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 62U, CPPCORE_ALPHABET_B62, true);
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::BaseX::tryparse(TXT, v, CPPCORE_ALPHABET_B62);
+      CppCore::Benchmark::donotoptimize(r);
+      CppCore::Benchmark::donotoptimize(v);
+   }
+}
+CPPCORE_BENCHMARK(Encoding, parseDecimal_u1024, 0)
+{
+   fill();
+   CppCore::uint1024_t v;
+   ::memcpy((void*)&v, BIN, sizeof(v));
+   CppCore::BaseX::tostring(v, TXT, sizeof(TXT), 10U, CPPCORE_ALPHABET_B10, true);
+   for (size_t i = 0; i < n; i++) {
+      v = CppCore::uint1024_t::parseDecimal(TXT);
+      CppCore::Benchmark::donotoptimize(v);
+   }
+}
@@ -0,0 +1,35 @@
+#include "Benchmark.h"
+#include <CppCore/Hash/CRC32.h>
+#include <CppCore/Hash/Murmur3.h>
+#include <CppCore/Hash/MD5.h>
+#include <CppCore/Hash/SHA2.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SMALL 64U
+#define LARGE 16384U
+//------------------------------------------------------------------------------------------------------------------------//
+CPPCORE_ALIGN64 static uint8_t DATA[LARGE];
+//------------------------------------------------------------------------------------------------------------------------//
+template<typename HASH, size_t LEN>
+static INLINE void hash(size_t n)
+{
+   typename HASH::Digest d;
+   for (size_t i = 0; i < n; i++) {
+      HASH::hashMem(DATA, LEN, d);
+      CppCore::Benchmark::donotoptimize(d);
+   }
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(Hash, CRC32_64,      SMALL) { hash<CppCore::CRC32,   SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, CRC32_16K,     LARGE) { hash<CppCore::CRC32,   LARGE>(n); }
+CPPCORE_BENCHMARK(Hash, CRC32C_64,     SMALL) { hash<CppCore::CRC32C,  SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, CRC32C_16K,    LARGE) { hash<CppCore::CRC32C,  LARGE>(n); }
+CPPCORE_BENCHMARK(Hash, Murmur3_64,    SMALL) { hash<CppCore::Murmur3, SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, Murmur3_16K,   LARGE) { hash<CppCore::Murmur3, LARGE>(n); }
+CPPCORE_BENCHMARK(Hash, MD5_64,        SMALL) { hash<CppCore::MD5,     SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, MD5_16K,       LARGE) { hash<CppCore::MD5,     LARGE>(n); }
+CPPCORE_BENCHMARK(Hash, SHA256_64,     SMALL) { hash<CppCore::SHA256,  SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, SHA256_16K,    LARGE) { hash<CppCore::SHA256,  LARGE>(n); }
+CPPCORE_BENCHMARK(Hash, SHA512_64,     SMALL) { hash<CppCore::SHA512,  SMALL>(n); }
+CPPCORE_BENCHMARK(Hash, SHA512_16K,    LARGE) { hash<CppCore::SHA512,  LARGE>(n); }
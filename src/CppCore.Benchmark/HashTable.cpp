@@ -0,0 +1,108 @@
+#include "Benchmark.h"
+#include <CppCore/Containers/HashTable.h>
+#include <thread>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SMALL 4096U
+#define LARGE 1048576U
+//------------------------------------------------------------------------------------------------------------------------//
+using CMP = CppCore::Comparer<uint32_t, uint32_t>;
+template<size_t N> using HashST = CppCore::HashTable::ST<uint32_t, uint32_t, N, CMP>;
+template<size_t N> using HashFL = CppCore::HashTable::Flat<uint32_t, uint32_t, N, CMP>;
+template<size_t N> using HashMT = CppCore::HashTable::MT<uint32_t, uint32_t, N, CMP>;
+#define THREADS 4U
+//------------------------------------------------------------------------------------------------------------------------//
+static INLINE uint32_t key(size_t i)
+{
+   return (uint32_t)(i * 0x9E3779B1U);
+}
+template<size_t N>
+static INLINE size_t shuffled(size_t i)
+{
+   // odd multiplier, visits all in other order than inserted
+   return (i * 1367U) & (N-1U);
+}
+template<typename HT, size_t N>
+static INLINE HT& filled()
+{
+   static HT* ht = 0;
+   if (!ht)
+   {
+      ht = new HT();
+      for (size_t i = 0; i < N; i++)
+         ht->insert(key(i), key(i));
+   }
+   return *ht;
+}
+template<typename HT, size_t N>
+static INLINE void findhit(size_t n)
+{
+   HT& ht = filled<HT, N>();
+   for (size_t i = 0; i < n; i++) {
+      uint32_t* r = ht.find(key(shuffled<N>(i)));
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+template<typename HT, size_t N>
+static INLINE void findmiss(size_t n)
+{
+   HT& ht = filled<HT, N>();
+   for (size_t i = 0; i < n; i++) {
+      uint32_t* r = ht.find(key(i + N));
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+template<typename HT, size_t N>
+static INLINE void insertremove(size_t n)
+{
+   HT& ht = filled<HT, N>();
+   for (size_t i = 0; i < n; i++) {
+      const uint32_t k = key(shuffled<N>(i));
+      ht.removeAndPushFree(k);
+      ht.insert(k, k);
+      CppCore::Benchmark::clobber();
+   }
+}
+template<size_t N>
+static INLINE void findhitmt(size_t n)
+{
+   HashMT<N>& ht = filled<HashMT<N>, N>();
+   uint32_t r = 0;
+   for (size_t i = 0; i < n; i++) {
+      ht.find(key(shuffled<N>(i)), r);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+template<size_t N>
+static INLINE void findhitmtthreaded(size_t n)
+{
+   // n lookups in total, split across threads
+   HashMT<N>& ht = filled<HashMT<N>, N>();
+   std::thread threads[THREADS];
+   for (size_t t = 0; t < THREADS; t++)
+      threads[t] = std::thread([&ht, n, t]() {
+         uint32_t r = 0;
+         for (size_t i = t; i < n; i += THREADS) {
+            ht.find(key(shuffled<N>(i)), r);
+            CppCore::Benchmark::donotoptimize(r);
+         }
+      });
+   for (size_t t = 0; t < THREADS; t++)
+      threads[t].join();
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(HashTable, ST_find_hit_4K,          0) { findhit<HashST<SMALL>, SMALL>(n);      }
+CPPCORE_BENCHMARK(HashTable, Flat_find_hit_4K,        0) { findhit<HashFL<SMALL>, SMALL>(n);      }
+CPPCORE_BENCHMARK(HashTable, ST_find_miss_4K,         0) { findmiss<HashST<SMALL>, SMALL>(n);     }
+CPPCORE_BENCHMARK(HashTable, Flat_find_miss_4K,       0) { findmiss<HashFL<SMALL>, SMALL>(n);     }
+CPPCORE_BENCHMARK(HashTable, ST_insert_remove_4K,     0) { insertremove<HashST<SMALL>, SMALL>(n); }
+CPPCORE_BENCHMARK(HashTable, Flat_insert_remove_4K,   0) { insertremove<HashFL<SMALL>, SMALL>(n); }
+CPPCORE_BENCHMARK(HashTable, ST_find_hit_1M,          0) { findhit<HashST<LARGE>, LARGE>(n);      }
+CPPCORE_BENCHMARK(HashTable, Flat_find_hit_1M,        0) { findhit<HashFL<LARGE>, LARGE>(n);      }
+CPPCORE_BENCHMARK(HashTable, ST_find_miss_1M,         0) { findmiss<HashST<LARGE>, LARGE>(n);     }
+CPPCORE_BENCHMARK(HashTable, Flat_find_miss_1M,       0) { findmiss<HashFL<LARGE>, LARGE>(n);     }
+CPPCORE_BENCHMARK(HashTable, ST_insert_remove_1M,     0) { insertremove<HashST<LARGE>, LARGE>(n); }
+CPPCORE_BENCHMARK(HashTable, Flat_insert_remove_1M,   0) { insertremove<HashFL<LARGE>, LARGE>(n); }
+CPPCORE_BENCHMARK(HashTable, MT_find_hit_4K,          0) { findhitmt<SMALL>(n);                   }
+CPPCORE_BENCHMARK(HashTable, MT_find_hit_4K_4threads, 0) { findhitmtthreaded<SMALL>(n);           }
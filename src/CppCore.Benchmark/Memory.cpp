@@ -0,0 +1,67 @@
+#include "Benchmark.h"
+#include <CppCore/Memory.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SMALL 64U
+#define LARGE 65536U
+//------------------------------------------------------------------------------------------------------------------------//
+CPPCORE_ALIGN64 static uint8_t SRC[LARGE+64U];
+CPPCORE_ALIGN64 static uint8_t DST[LARGE+64U];
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(Memory, copy_64, SMALL)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::copy(DST, SRC, SMALL);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, copy_64K, LARGE)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::copy(DST, SRC, LARGE);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, copy_64K_unaligned, LARGE)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::copy(DST+1, SRC+3, LARGE);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, copyreverse_64K, LARGE)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::copyreverse(DST, SRC, LARGE);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, clear_64, SMALL)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::clear(DST, SMALL);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, clear_64K, LARGE)
+{
+   for (size_t i = 0; i < n; i++) {
+      CppCore::Memory::clear(DST, LARGE);
+      CppCore::Benchmark::clobber();
+   }
+}
+CPPCORE_BENCHMARK(Memory, equal_64, SMALL)
+{
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::Memory::equal(DST, SRC, SMALL);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
+CPPCORE_BENCHMARK(Memory, equal_64K, LARGE)
+{
+   for (size_t i = 0; i < n; i++) {
+      bool r = CppCore::Memory::equal(DST, SRC, LARGE);
+      CppCore::Benchmark::donotoptimize(r);
+   }
+}
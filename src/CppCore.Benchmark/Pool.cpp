@@ -0,0 +1,46 @@
+#include "Benchmark.h"
+#include <CppCore/Containers/Pool.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define SIZE  1024U
+#define BURST 8U
+//------------------------------------------------------------------------------------------------------------------------//
+struct Item { uint8_t data[64]; };
+using PoolST = CppCore::Pool::Fix::ST<Item, SIZE>;
+using PoolMT = CppCore::Pool::Fix::MT<Item, SIZE>;
+using PoolMTCached = CppCore::Pool::Fix::MTCached<Item, SIZE>;
+//------------------------------------------------------------------------------------------------------------------------//
+/// <summary>
+/// Mutex guarded pointer stack, like Pool::Fix::MT before it was lock-free.
+/// </summary>
+class PoolLocked : public CppCore::Array::Fix::MT<Item*, SIZE>
+{
+   Item mPool[SIZE];
+public:
+   INLINE PoolLocked() { for (size_t i = 0; i < SIZE; i++) pushBack(&mPool[i]); }
+};
+//------------------------------------------------------------------------------------------------------------------------//
+template<typename POOL>
+static INLINE POOL& instance()
+{
+   static POOL* pool = new POOL();
+   return *pool;
+}
+template<typename POOL>
+static INLINE void popburst(size_t n)
+{
+   // pops some buffers and pushes them back, like a send or receive path
+   POOL& pool = instance<POOL>();
+   Item* items[BURST];
+   for (size_t i = 0; i < n; i += BURST) {
+      for (size_t j = 0; j < BURST; j++) pool.popBack(items[j]);
+      CppCore::Benchmark::donotoptimize(items);
+      for (size_t j = 0; j < BURST; j++) pool.pushBack(items[j]);
+   }
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(Pool, ST_pop_push,     0) { popburst<PoolST>(n);     }
+CPPCORE_BENCHMARK(Pool, Locked_pop_push, 0) { popburst<PoolLocked>(n); }
+CPPCORE_BENCHMARK(Pool, MT_pop_push,     0) { popburst<PoolMT>(n);     }
+CPPCORE_BENCHMARK(Pool, MTCached_pop_push, 0) { popburst<PoolMTCached>(n); }
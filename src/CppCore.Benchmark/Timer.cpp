@@ -0,0 +1,56 @@
+#include "Benchmark.h"
+#include <CppCore/Threading/Runnable.h>
+
+//------------------------------------------------------------------------------------------------------------------------//
+#define TIMERS 10000U
+//------------------------------------------------------------------------------------------------------------------------//
+using Heap  = CppCore::Runnable::MinHeap<16383U>;
+using Wheel = CppCore::Runnable::TimerWheel<>;
+class Timer : public CppCore::Runnable
+{
+public:
+   using CppCore::Runnable::setExecutionTime;
+};
+//------------------------------------------------------------------------------------------------------------------------//
+static INLINE Timer* timers()
+{
+   static Timer* t = 0;
+   if (!t)
+   {
+      t = new Timer[TIMERS];
+      const CppCore::TimePointHR NOW = CppCore::ClockHR::now();
+      for (size_t i = 0; i < TIMERS; i++)
+         t[i].setExecutionTime(NOW + CppCore::milliseconds(1000U + ((i * 7919U) % 60000U)));
+   }
+   return t;
+}
+template<typename TS>
+static INLINE TS& filled()
+{
+   static TS* ts = 0;
+   if (!ts)
+   {
+      Timer* t = timers();
+      ts = new TS();
+      for (size_t i = 0; i < TIMERS; i++)
+         ts->push(&t[i]);
+   }
+   return *ts;
+}
+template<typename TS>
+static INLINE void cancelreschedule(size_t n)
+{
+   // timeouts cancelled and rescheduled long before they fire
+   TS& ts = filled<TS>();
+   Timer* t = timers();
+   for (size_t i = 0; i < n; i++) {
+      Timer* r = &t[(i * 1367U) % TIMERS];
+      ts.remove(r);
+      ts.push(r);
+      CppCore::Benchmark::clobber();
+   }
+}
+//------------------------------------------------------------------------------------------------------------------------//
+
+CPPCORE_BENCHMARK(Timer, MinHeap_cancel_reschedule_10K,    0) { cancelreschedule<Heap>(n);  }
+CPPCORE_BENCHMARK(Timer, TimerWheel_cancel_reschedule_10K, 0) { cancelreschedule<Wheel>(n); }
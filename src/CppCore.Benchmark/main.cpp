@@ -1,29 +1,77 @@
+#include "Benchmark.h"
 
-#include "vectors.h"
+using namespace CppCore::Benchmark;
 
-int main()
+static void usage(const char* exe)
 {
-   while (true)
+   ::printf(
+      "Usage: %s [options]\n"
+      "  --list            list registered benchmarks and exit\n"
+      "  --filter <text>   only run benchmarks whose 'Suite/Name' contains text\n"
+      "  --samples <n>     samples per benchmark (default 31)\n"
+      "  --time <ms>       target milliseconds per sample (default 10)\n"
+      "  --warmup <ms>     warm-up milliseconds per benchmark (default 100)\n"
+      "  --json <file>     write results as JSON to file\n", exe);
+}
+
+int main(int argc, char* argv[])
+{
+   Runner runner;
+   const char* filter = 0;
+   const char* json   = 0;
+   bool        list   = false;
+
+   for (int i = 1; i < argc; i++)
    {
-      BenchV2f();
+      const bool HASVAL = i + 1 < argc;
+      if      (!::strcmp(argv[i], "--list"))              list   = true;
+      else if (!::strcmp(argv[i], "--filter")  && HASVAL) filter = argv[++i];
+      else if (!::strcmp(argv[i], "--json")    && HASVAL) json   = argv[++i];
+      else if (!::strcmp(argv[i], "--samples") && HASVAL) runner.samples = (size_t)::strtoull(argv[++i], 0, 10);
+      else if (!::strcmp(argv[i], "--time")    && HASVAL) runner.target  = (size_t)::strtoull(argv[++i], 0, 10);
+      else if (!::strcmp(argv[i], "--warmup")  && HASVAL) runner.warmup  = (size_t)::strtoull(argv[++i], 0, 10);
+      else { usage(argv[0]); return 1; }
+   }
 
-      BenchV3f();
-      //BenchV2d();
-      //BenchV2i();
-      //BenchV2l();
+   // group by suite, keep registration order inside a suite
+   std::vector<Entry>& entries = Registry::get();
+   std::stable_sort(entries.begin(), entries.end(),
+      [](const Entry& a, const Entry& b) { return a.suite < b.suite; });
 
-      //BenchV3f();
-      //BenchV3d();
-      //BenchV3i();
-      //BenchV3l();
+   if (list)
+   {
+      for (const Entry& e : entries)
+         ::printf("%s/%s\n", e.suite.c_str(), e.name.c_str());
+      return 0;
+   }
 
-      //BenchV4f();
-      //BenchV4d();
-      //BenchV4i();
-      //BenchV4l();
+   const Features cpu;
+   ::printf("CPU:       %s %s\n", cpu.vendor.c_str(), cpu.brand.c_str());
+   ::printf("Compiled: ");
+   for (const char* s : cpu.compiled) ::printf(" %s", s);
+   ::printf("\nSupported:");
+   for (const char* s : cpu.supported) ::printf(" %s", s);
+   ::printf("\n");
 
-      getchar();
+   std::vector<Result> results;
+   std::string suite;
+   for (const Entry& e : entries)
+   {
+      if (filter && (e.suite + "/" + e.name).find(filter) == std::string::npos)
+         continue;
+      if (results.empty() || suite != e.suite)
+      {
+         suite = e.suite;
+         Report::header(suite);
+      }
+      results.push_back(runner.run(e));
+      Report::print(results.back());
    }
 
+   if (json && !Report::json(json, results, cpu))
+   {
+      ::printf("Failed to write %s\n", json);
+      return 1;
+   }
    return 0;
 }
@@ -1,20 +0,0 @@
-#pragma once
-
-#include <CppCore/Math/V2.h>
-#include <CppCore/Math/V3.h>
-#include <CppCore/Math/V4.h>
-
-void BenchV2f();
-void BenchV2d();
-void BenchV2i();
-void BenchV2l();
-
-void BenchV3f();
-void BenchV3d();
-void BenchV3i();
-void BenchV3l();
-
-void BenchV4f();
-void BenchV4d();
-void BenchV4i();
-void BenchV4l();
\ No newline at end of file
@@ -378,6 +378,25 @@ int main()
    TEST(CppCore::Test::Math::Util::umulmod64,       "umulmod64:        ", std::endl);
    TEST(CppCore::Test::Math::Util::upowmod32,       "upowmod32:        ", std::endl);
    TEST(CppCore::Test::Math::Util::upowmod64,       "upowmod64:        ", std::endl);
+   TEST(CppCore::Test::Math::Util::upowmod<CppCore::uint128_t>,  "upowmod128:       ", std::endl);
+   TEST(CppCore::Test::Math::Util::upowmod<CppCore::uint512_t>,  "upowmod512:       ", std::endl);
+   TEST(CppCore::Test::Math::Util::upowmod<CppCore::uint2048_t>, "upowmod2048:      ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<uint64_t>,  "montgomery64:     ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<CppCore::uint128_t>, "montgomery128:    ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<CppCore::uint256_t>, "montgomery256:    ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<CppCore::uint512_t>, "montgomery512:    ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<CppCore::uint1024_t>, "montgomery1024:   ", std::endl);
+   TEST(CppCore::Test::Math::Util::montgomery<CppCore::uint2048_t>, "montgomery2048:   ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<uint64_t>,  "barrett64:        ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<CppCore::uint128_t>, "barrett128:       ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<CppCore::uint256_t>, "barrett256:       ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<CppCore::uint512_t>, "barrett512:       ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<CppCore::uint1024_t>, "barrett1024:      ", std::endl);
+   TEST(CppCore::Test::Math::Util::barrett<CppCore::uint2048_t>, "barrett2048:      ", std::endl);
+   TEST(CppCore::Test::Math::Util::umulk<CppCore::uint256_t>,  "umulk256:         ", std::endl);
+   TEST(CppCore::Test::Math::Util::umulk<CppCore::uint1024_t>, "umulk1024:        ", std::endl);
+   TEST(CppCore::Test::Math::Util::umulk<CppCore::uint2048_t>, "umulk2048:        ", std::endl);
+   TEST(CppCore::Test::Math::Util::umulk<CppCore::uint4096_t>, "umulk4096:        ", std::endl);
    TEST(CppCore::Test::Math::Util::upow32,          "upow32:           ", std::endl);
    TEST(CppCore::Test::Math::Util::upow64,          "upow64:           ", std::endl);
    TEST(CppCore::Test::Math::Util::udivmod32,       "udivmod32:        ", std::endl);
@@ -556,6 +575,7 @@ int main()
    TEST(CppCore::Test::Hash::CRC32::crc32test1<CppCore::CRC32g>, "crc32gtest1: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32test2<CppCore::CRC32g>, "crc32gtest2: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32test3<CppCore::CRC32g>, "crc32gtest3: ", std::endl);
+   TEST(CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32g>,  "crc32gbulk:  ", std::endl);
 #if defined(CPPCORE_CPUFEAT_ARM_CRC32)
    TEST(CppCore::Test::Hash::CRC32::crc32test1<CppCore::CRC32s>, "crc32stest1: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32test2<CppCore::CRC32s>, "crc32stest2: ", std::endl);
@@ -564,10 +584,12 @@ int main()
    TEST(CppCore::Test::Hash::CRC32::crc32ctest1<CppCore::CRC32Cg>, "crc32cgtest1: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32ctest2<CppCore::CRC32Cg>, "crc32cgtest2: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32ctest3<CppCore::CRC32Cg>, "crc32cgtest3: ", std::endl);
+   TEST(CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32Cg>,   "crc32cgbulk:  ", std::endl);
 #if defined(CPPCORE_CPUFEAT_SSE42) || defined(CPPCORE_CPUFEAT_ARM_CRC32)
    TEST(CppCore::Test::Hash::CRC32::crc32ctest1<CppCore::CRC32Cs>, "crc32cstest1: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32ctest2<CppCore::CRC32Cs>, "crc32cstest2: ", std::endl);
    TEST(CppCore::Test::Hash::CRC32::crc32ctest3<CppCore::CRC32Cs>, "crc32cstest3: ", std::endl);
+   TEST((CppCore::Test::Hash::CRC32::crc32bulk<CppCore::CRC32Cs, CppCore::CRC32Cg>), "crc32csbulk:  ", std::endl);
 #endif
 
    std::cout << "-------------------------------" << std::endl;
@@ -624,6 +646,8 @@ int main()
    TEST(CppCore::Test::Crypto::PBKDF2::sha256test1, "sha256test1: ", std::endl);
    TEST(CppCore::Test::Crypto::PBKDF2::sha512test1, "sha512test1: ", std::endl);
    TEST(CppCore::Test::Crypto::PBKDF2::sha512test2, "sha512test2: ", std::endl);
+   TEST(CppCore::Test::Crypto::PBKDF2::sha512test2mt, "sha512test2mt: ", std::endl);
+   TEST(CppCore::Test::Crypto::PBKDF2::sha256test2mt, "sha256test2mt: ", std::endl);
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "    CppCore::Crypto::AES128g   " << std::endl;
@@ -653,6 +677,7 @@ int main()
    TEST(CppCore::Test::Crypto::AES::ecb128<CppCore::AES128s>, "ecb128s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::cbc128<CppCore::AES128s>, "cbc128s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::ctr128<CppCore::AES128s>, "ctr128s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::bulk128s,                 "bulk128s:", std::endl);
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "    CppCore::Crypto::AES192s   " << std::endl;
@@ -660,6 +685,7 @@ int main()
    TEST(CppCore::Test::Crypto::AES::ecb192<CppCore::AES192s>, "ecb192s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::cbc192<CppCore::AES192s>, "cbc192s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::ctr192<CppCore::AES192s>, "ctr192s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::bulk192s,                 "bulk192s:", std::endl);
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "    CppCore::Crypto::AES256s   " << std::endl;
@@ -667,6 +693,26 @@ int main()
    TEST(CppCore::Test::Crypto::AES::ecb256<CppCore::AES256s>, "ecb256s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::cbc256<CppCore::AES256s>, "cbc256s: ", std::endl);
    TEST(CppCore::Test::Crypto::AES::ctr256<CppCore::AES256s>, "ctr256s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::bulk256s,                 "bulk256s:", std::endl);
+#endif
+
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "    CppCore::Crypto::GCMg      " << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Crypto::AES::gcm128<CppCore::AES128GCMg>, "gcm128g: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcm192<CppCore::AES192GCMg>, "gcm192g: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcm256<CppCore::AES256GCMg>, "gcm256g: ", std::endl);
+
+#if defined(CPPCORE_CPUFEAT_AES) && defined(CPPCORE_CPUFEAT_SSE41) && defined(CPPCORE_CPUFEAT_PCLMUL)
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "    CppCore::Crypto::GCMs      " << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Crypto::AES::gcm128<CppCore::AES128GCMs>, "gcm128s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcm192<CppCore::AES192GCMs>, "gcm192s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcm256<CppCore::AES256GCMs>, "gcm256s: ", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcmbulk128s,                 "gcmbulk128s:", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcmbulk192s,                 "gcmbulk192s:", std::endl);
+   TEST(CppCore::Test::Crypto::AES::gcmbulk256s,                 "gcmbulk256s:", std::endl);
 #endif
 
    std::cout << "-------------------------------" << std::endl;
@@ -691,12 +737,89 @@ int main()
    TEST(CppCore::Test::Containers::Queue::fillmaxthenempty2, "fillmaxthenempty2: ", std::endl);
    TEST(CppCore::Test::Containers::Queue::fillmaxthenempty3, "fillmaxthenempty3: ", std::endl);
    TEST(CppCore::Test::Containers::Queue::fillmaxthenempty4, "fillmaxthenempty4: ", std::endl);
+#ifndef CPPCORE_NO_THREADING
+   TEST(CppCore::Test::Containers::Queue::lockfreefifo1,     "lockfreefifo1:     ", std::endl);
+   TEST(CppCore::Test::Containers::Queue::lockfreefifo2,     "lockfreefifo2:     ", std::endl);
+   TEST(CppCore::Test::Containers::Queue::lockfreefifo3,     "lockfreefifo3:     ", std::endl);
+   TEST(CppCore::Test::Containers::Queue::lockfreefifo4,     "lockfreefifo4:     ", std::endl);
+   TEST(CppCore::Test::Containers::Queue::lockfreethreaded1, "lockfreethreaded1: ", std::endl);
+   TEST(CppCore::Test::Containers::Queue::lockfreethreaded2, "lockfreethreaded2: ", std::endl);
+#endif
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "CppCore::Containers::HashTable"  << std::endl;
    std::cout << "-------------------------------" << std::endl;
-   TEST(CppCore::Test::Containers::HashTable::modelid,   "modelid:   ", std::endl);
-   TEST(CppCore::Test::Containers::HashTable::modelname, "modelname: ", std::endl);
+   TEST(CppCore::Test::Containers::HashTable::modelid,       "modelid:       ", std::endl);
+   TEST(CppCore::Test::Containers::HashTable::modelname,     "modelname:     ", std::endl);
+   TEST(CppCore::Test::Containers::HashTable::flat,          "flat:          ", std::endl);
+#ifndef CPPCORE_NO_THREADING
+   TEST(CppCore::Test::Containers::HashTable::mt,            "mt:            ", std::endl);
+   TEST(CppCore::Test::Containers::HashTable::mtthreaded,    "mtthreaded:    ", std::endl);
+#endif
+
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "  CppCore::Containers::Cache"    << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Containers::Cache::lru,   "lru:   ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::clock, "clock: ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::lrufewer,   "lrufewer:   ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::clockfewer, "clockfewer: ", std::endl);
+#ifndef CPPCORE_NO_THREADING
+   TEST(CppCore::Test::Containers::Cache::lrurecent,   "lrurecent:   ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::clockrecent, "clockrecent: ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::mt,         "mt:         ", std::endl);
+   TEST(CppCore::Test::Containers::Cache::mtthreaded, "mtthreaded: ", std::endl);
+#endif
+
+#ifndef CPPCORE_NO_THREADING
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "  CppCore::Containers::Pool"     << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Containers::Pool::mt<100>,    "mt:         ", std::endl);
+   TEST(CppCore::Test::Containers::Pool::mtcached,   "mtcached:   ", std::endl);
+   TEST(CppCore::Test::Containers::Pool::mtthreaded, "mtthreaded: ", std::endl);
+   TEST(CppCore::Test::Containers::Pool::capacityexact,  "capacityexact:  ", std::endl);
+   TEST(CppCore::Test::Containers::Pool::capacitycached, "capacitycached: ", std::endl);
+#endif
+
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "  CppCore::Threading::Runnable"  << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Threading::Runnable::timerwheelnext,    "timerwheelnext:    ", std::endl);
+   TEST(CppCore::Test::Threading::Runnable::timerwheelcascade, "timerwheelcascade: ", std::endl);
+   TEST(CppCore::Test::Threading::Runnable::timerwheelremove,  "timerwheelremove:  ", std::endl);
+   TEST(CppCore::Test::Threading::Runnable::minheap,           "minheap:           ", std::endl);
+
+#ifndef CPPCORE_NO_THREADING
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "  CppCore::Threading::Schedule"  << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Threading::Schedule::steal<CppCore::Test::Threading::Schedule::Heap>,   "stealheap:   ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::detach<CppCore::Test::Threading::Schedule::Heap>,  "detachheap:  ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::cancel<CppCore::Test::Threading::Schedule::Heap>,  "cancelheap:  ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::wake<CppCore::Test::Threading::Schedule::Heap>,    "wakeheap:    ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::timers<CppCore::Test::Threading::Schedule::Heap>,  "timersheap:  ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::fair<CppCore::Test::Threading::Schedule::Heap>,    "fairheap:    ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::steal<CppCore::Test::Threading::Schedule::Wheel>,  "stealwheel:  ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::detach<CppCore::Test::Threading::Schedule::Wheel>, "detachwheel: ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::cancel<CppCore::Test::Threading::Schedule::Wheel>, "cancelwheel: ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::wake<CppCore::Test::Threading::Schedule::Wheel>,   "wakewheel:   ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::timers<CppCore::Test::Threading::Schedule::Wheel>, "timerswheel: ", std::endl);
+   TEST(CppCore::Test::Threading::Schedule::fair<CppCore::Test::Threading::Schedule::Wheel>,   "fairwheel:   ", std::endl);
+#endif
+
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "         CppCore::Logger"       << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Logger::formats,    "formats:    ", std::endl);
+   TEST(CppCore::Test::Logger::ring,       "ring:       ", std::endl);
+   TEST(CppCore::Test::Logger::longstring, "longstring: ", std::endl);
+   TEST(CppCore::Test::Logger::loggers,    "loggers:    ", std::endl);
+#ifndef CPPCORE_NO_THREADING
+   TEST(CppCore::Test::Logger::mt,         "mt:         ", std::endl);
+   TEST(CppCore::Test::Logger::dropped,    "dropped:    ", std::endl);
+   TEST(CppCore::Test::Logger::destructor, "destructor: ", std::endl);
+#endif
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "          CppCore::Uuid"         << std::endl;
@@ -722,6 +845,9 @@ int main()
    TEST(CppCore::Test::Encoding::BaseX::tostring16,      "tostring16:      ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::tostring32,      "tostring32:      ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::tostring64,      "tostring64:      ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tostring128,     "tostring128:     ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tostring1024,    "tostring1024:    ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tostring4096,    "tostring4096:    ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::parse8,          "parse8:          ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::parse16,         "parse16:         ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::parse32,         "parse32:         ", std::endl);
@@ -732,6 +858,9 @@ int main()
    TEST(CppCore::Test::Encoding::BaseX::tryparse32,      "tryparse32:      ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::tryparse64,      "tryparse64:      ", std::endl);
    TEST(CppCore::Test::Encoding::BaseX::tryparse128,     "tryparse128:     ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tryparse256,     "tryparse256:     ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tryparse1024,    "tryparse1024:    ", std::endl);
+   TEST(CppCore::Test::Encoding::BaseX::tryparse4096,    "tryparse4096:    ", std::endl);
 
    std::cout << "-------------------------------" << std::endl;
    std::cout << "   CppCore::Encoding::Decimal  " << std::endl;
@@ -774,6 +903,8 @@ int main()
    TEST(CppCore::Test::Encoding::Base64::encode_url,   "encode_url:   ", std::endl);
    TEST(CppCore::Test::Encoding::Base64::decode_std,   "decode_std:   ", std::endl);
    TEST(CppCore::Test::Encoding::Base64::decode_url,   "decode_url:   ", std::endl);
+   TEST(CppCore::Test::Encoding::Base64::bulk_std,     "bulk_std:     ", std::endl);
+   TEST(CppCore::Test::Encoding::Base64::bulk_url,     "bulk_url:     ", std::endl);
 
 #ifndef CPPCORE_NO_SOCKET
    std::cout << "-------------------------------" << std::endl;
@@ -790,6 +921,20 @@ int main()
    TEST(CppCore::Test::Network::Socket::bindlistenipv6dstcp,  "bindlistenipv6dstcp:  ", std::endl);
    TEST(CppCore::Test::Network::Socket::setoptsipv4tcp,       "setoptsipv4tcp:       ", std::endl);
    TEST(CppCore::Test::Network::Socket::setoptsipv6tcp,       "setoptsipv6tcp:       ", std::endl);
+   TEST(CppCore::Test::Network::Socket::sendvipv4tcp,         "sendvipv4tcp:         ", std::endl);
+   TEST(CppCore::Test::Network::Socket::dgrambatchipv4udp,    "dgrambatchipv4udp:    ", std::endl);
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "        CppCore::TcpLink"        << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Network::TcpLink::shortwrites, "shortwrites: ", std::endl);
+#ifndef CPPCORE_NO_THREADING
+   std::cout << "-------------------------------" << std::endl;
+   std::cout << "        CppCore::TcpServer"      << std::endl;
+   std::cout << "-------------------------------" << std::endl;
+   TEST(CppCore::Test::Network::TcpServer::echo, "echo: ", std::endl);
+   TEST(CppCore::Test::Network::TcpServer::reactors, "reactors: ", std::endl);
+   TEST(CppCore::Test::Network::TcpServer::listenfail, "listenfail: ", std::endl);
+#endif
 #endif
 
    std::cout << "-------------------------------" << std::endl;